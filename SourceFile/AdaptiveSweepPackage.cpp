@@ -0,0 +1,123 @@
+/*
+	This is cpp file of the class of "AdaptiveSweepPackage" that chooses the numbers of cars to be simulated adaptively.
+*/
+
+#include "AdaptiveSweepPackage.h"
+
+//constructor
+AdaptiveSweepPackage::AdaptiveSweepPackage(const int& NMax, const int& InitialStep, const double& Tolerance, const double& VarianceTolerance, const int& MaxPoints)
+	: NMax(NMax), InitialStep((std::max)(InitialStep, 1)), Tolerance(Tolerance), VarianceTolerance(VarianceTolerance), MaxPoints(MaxPoints) {
+	initialGridCreated = false;
+}
+
+//destructor
+AdaptiveSweepPackage::~AdaptiveSweepPackage() { }
+
+/*
+	V and the standard deviation of the local V in km/h.
+*/
+void AdaptiveSweepPackage::AddResult(const int& N, const double& V, const double& standardDeviation) {
+	Point point;
+	point.V = V;
+	point.standardDeviation = standardDeviation;
+	points[N] = point;
+}
+
+/*
+	N which could not be measured are never chosen again.
+*/
+void AdaptiveSweepPackage::AddFailure(const int& N) {
+	failed.insert(N);
+}
+
+/*
+	The numbers of cars to be simulated next. If the sweep has been finished, it is empty.
+*/
+std::vector<int> AdaptiveSweepPackage::NextNLists() {
+	int budget = MaxPoints - int(points.size());
+	std::vector<int> next;
+	if (!initialGridCreated) {
+		initialGridCreated = true;
+		const std::vector<int>&& grid = CreateInitialGrid();
+		for (std::size_t i = 0; i < grid.size() && budget > 0; i++) {
+			if (points.count(grid[i]) == 0 && failed.count(grid[i]) == 0) {
+				next.emplace_back(grid[i]);
+				budget--;
+			}
+		}
+		if (!next.empty()) {
+			return next;
+		}
+	}
+	if (budget <= 0 || points.size() < 2) {
+		return next;
+	}
+
+	//Score every interval between the neighbouring points. The interval is refined when its score exceeds 1.
+	std::vector<int> Ns;
+	std::vector<const Point*> Ps;
+	for (std::map<int, Point>::const_iterator it = points.begin(); it != points.end(); ++it) {
+		Ns.emplace_back(it->first);
+		Ps.emplace_back(&it->second);
+	}
+	std::vector<double> scores(Ns.size() - 1, 0);
+	for (std::size_t i = 0; i + 1 < Ns.size(); i++) {
+		//Large variance between the measurements.
+		if (VarianceTolerance > 0) {
+			scores[i] = (std::max)(Ps[i]->standardDeviation, Ps[i + 1]->standardDeviation) / VarianceTolerance;
+		}
+	}
+	for (std::size_t i = 1; i + 1 < Ns.size(); i++) {
+		//Disagreement with the linear interpolation of the neighbours, which means large curvature.
+		const double&& ratio = double(Ns[i] - Ns[i - 1]) / (Ns[i + 1] - Ns[i - 1]);
+		const double&& interpolated = Ps[i - 1]->V + (Ps[i + 1]->V - Ps[i - 1]->V) * ratio;
+		if (Tolerance > 0) {
+			const double&& score = std::abs(Ps[i]->V - interpolated) / Tolerance;
+			scores[i - 1] = (std::max)(scores[i - 1], score);
+			scores[i] = (std::max)(scores[i], score);
+		}
+	}
+
+	//Refine the worst intervals first within the remaining budget.
+	std::vector<std::pair<double, int> > candidates;
+	for (std::size_t i = 0; i < scores.size(); i++) {
+		if (scores[i] > 1) {
+			const int&& N = ChooseBetween(Ns[i], Ns[i + 1]);
+			if (N > 0) {
+				candidates.emplace_back(scores[i], N);
+			}
+		}
+	}
+	std::sort(candidates.begin(), candidates.end(), [](const std::pair<double, int>& a, const std::pair<double, int>& b) { return a.first > b.first; });
+	for (std::size_t i = 0; i < candidates.size() && budget > 0; i++) {
+		next.emplace_back(candidates[i].second);
+		budget--;
+	}
+	std::sort(next.begin(), next.end());
+	return next;
+}
+
+std::vector<int> AdaptiveSweepPackage::CreateInitialGrid() const {
+	std::vector<int> grid;
+	for (int N = 1; N < NMax; N += InitialStep) {
+		grid.emplace_back(N);
+	}
+	grid.emplace_back(NMax);
+	return grid;
+}
+
+/*
+	An untried N near the middle of the interval. If there is none, return 0.
+*/
+int AdaptiveSweepPackage::ChooseBetween(const int& NLower, const int& NUpper) const {
+	const int&& middle = (NLower + NUpper) / 2;
+	for (int d = 0; middle - d > NLower || middle + d < NUpper; d++) {
+		if (middle - d > NLower && failed.count(middle - d) == 0) {
+			return middle - d;
+		}
+		if (middle + d < NUpper && failed.count(middle + d) == 0) {
+			return middle + d;
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,43 @@
+/*
+	This is header file of the class of "AdaptiveSweepPackage" that chooses the numbers of cars to be simulated adaptively.
+	The sweep starts from a coarse grid of N, and the intervals of N are bisected recursively where the global velocity disagrees with the interpolation of its neighbours or the local velocities vary widely, typically near the critical density.
+	It stops when every interval meets the tolerances or the number of points reaches the upper limit.
+*/
+
+#ifndef ADAPTIVESWEEPPACKAGE_H
+#define ADAPTIVESWEEPPACKAGE_H
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <set>
+#include <vector>
+
+class AdaptiveSweepPackage {
+public:
+	AdaptiveSweepPackage(const int& NMax, const int& InitialStep, const double& Tolerance, const double& VarianceTolerance, const int& MaxPoints);	//constructor
+	~AdaptiveSweepPackage();	//destructor
+
+	void AddResult(const int& N, const double& V, const double& standardDeviation);	//V and the standard deviation of the local V in km/h.
+	void AddFailure(const int& N);	//N which could not be measured are never chosen again.
+	std::vector<int> NextNLists();	//The numbers of cars to be simulated next. If the sweep has been finished, it is empty.
+private:
+	struct Point {
+	public:
+		double V;
+		double standardDeviation;
+	};
+
+	const int NMax;
+	const int InitialStep;
+	const double Tolerance;
+	const double VarianceTolerance;
+	const int MaxPoints;
+	bool initialGridCreated;
+	std::map<int, Point> points;
+	std::set<int> failed;
+
+	std::vector<int> CreateInitialGrid() const;
+	int ChooseBetween(const int& NLower, const int& NUpper) const;	//An untried N near the middle of the interval. If there is none, return 0.
+};
+
+#endif // !ADAPTIVESWEEPPACKAGE_H
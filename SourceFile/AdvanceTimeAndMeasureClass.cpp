@@ -6,13 +6,59 @@
 #include "AdvanceTimeAndMeasureClass.h"
 
 //constructor
-AdvanceTimeAndMeasureClass::AdvanceTimeAndMeasureClass(const std::string& IniFileFolderPath, const int& IniFileNumber, const int& N, const ModelParametersClass& ModelParameters, const StatisticsParametersClass& StatisticsParameters, const bool& CreateSnapShot, const int& RunNumber, const std::string& SnapShotFolderPath)
-	: ModelBaseClass(RunNumber, N, ModelParameters, StatisticsParameters)
-	, PedalChnage(new PedalChangePackage(ModelParameters.deltaT))
-	, CreateSnapShot(CreateSnapShot) {
+AdvanceTimeAndMeasureClass::AdvanceTimeAndMeasureClass(const ProfileParametersClass& ProfileParameters, const int& N, const ModelParametersClass& ModelParameters, const StatisticsParametersClass& StatisticsParameters, const bool& CreateSnapShot, const int& RunNumber, const unsigned int& Seed, const std::string& SnapShotFolderPath, SnapShotArchivePackage* const SnapShotArchive, const RunUpCachePackage* const RunUpCache, const CheckpointPackage* const Checkpoint, const FlightRecorderPackage* const FlightRecorder, const SpaceTimeFieldPackage* const SpaceTimeField, const JamTrackerPackage* const JamTracker, const TimeSeriesPackage* const TimeSeries, const DetectorArrayPackage* const DetectorArray, LiveStatePackage* const LiveState)
+	: ModelBaseClass(Seed, N, ModelParameters, StatisticsParameters)
+	, ProfileParameters(ProfileParameters)
+	, CreateSnapShot(CreateSnapShot)
+	, RunUpCache(RunUpCache)
+	, Checkpoint(Checkpoint)
+	, FlightRecorder(FlightRecorder)
+	, SpaceTimeField(SpaceTimeField)
+	, JamTracker(JamTracker)
+	, TimeSeries(TimeSeries)
+	, LiveState(LiveState)
+	, PedalChnage(new PedalChangePackage(ModelParameters.deltaT)) {
 	deletedPedalChnage = false;
 	InitializeProperties(this);
 	_initializeSuccess = false;
+	_attempt = 0;
+	_interrupted = false;
+	_succedMeasure = false;
+	SnapShotWriter = nullptr;
+	if (CreateSnapShot) {
+		SnapShotWriter = new SnapShotWriterPackage(N, ModelParameters, StatisticsParameters, SnapShotArchive);
+	}
+	flightRecorderRing = nullptr;
+	if (FlightRecorder != nullptr) {
+		flightRecorderRing = new FlightRecorderPackage::Ring(N, FlightRecorder->Steps, ModelParameters.deltaT);
+	}
+	fieldGrid = nullptr;
+	if (SpaceTimeField != nullptr) {
+		fieldGrid = new SpaceTimeFieldPackage::Grid(*SpaceTimeField);
+	}
+	jamClusters = nullptr;
+	if (JamTracker != nullptr) {
+		jamClusters = new JamTrackerPackage::Clusters(*JamTracker, N);
+	}
+	timeSeriesSamples = nullptr;
+	if (TimeSeries != nullptr) {
+		timeSeriesSamples = new TimeSeriesPackage::Series(*TimeSeries, N, StatisticsParameters.UnitMeasurementTime);
+	}
+	detectorCounters = nullptr;
+	if (DetectorArray != nullptr) {
+		detectorCounters = new DetectorArrayPackage::Counters(*DetectorArray, N);
+	}
+	liveStateSlot = LiveState == nullptr ? -1 : LiveState->Acquire(N);
+	liveStateSteps = 0;
+	if (CreateSnapShot || flightRecorderRing != nullptr || liveStateSlot >= 0) {
+		stepAccelerations.assign(std::size_t(N), 0);
+	}
+	DecideDriverTargetAcceleration = nullptr;
+	UpdatePosition = nullptr;
+	statistics = nullptr;
+	phase = PhaseType::RunUp;
+	elapsed = 0;
+	measureNumber = 0;
 	if (RunNumber == 0) {
 		SnapShotFileNameBase = SnapShotFolderPath + R"(/SnapShot)" + "_N" + std::to_string(N);
 	}
@@ -20,7 +66,7 @@ AdvanceTimeAndMeasureClass::AdvanceTimeAndMeasureClass(const std::string& IniFil
 		SnapShotFileNameBase = SnapShotFolderPath + R"(/SnapShot)" + "_RunN" + std::to_string(RunNumber) + "_N" + std::to_string(N);
 	}
 
-	Initialize(IniFileFolderPath, IniFileNumber);
+	Initialize();
 }
 
 //destructor
@@ -28,6 +74,15 @@ AdvanceTimeAndMeasureClass::~AdvanceTimeAndMeasureClass() {
 	SafeDelete(DecideDriverTargetAcceleration);	//delete DecideDriverTargetAccelerationClass
 	SafeDelete(UpdatePosition);	//delete UpdatePositionClass
 	SafeDelete(statistics);		//delete StatisticsClass
+	SafeDelete(SnapShotWriter);	//delete SnapShotWriterPackage
+	SafeDelete(flightRecorderRing);	//delete FlightRecorderPackage::Ring
+	SafeDelete(fieldGrid);	//delete SpaceTimeFieldPackage::Grid
+	SafeDelete(jamClusters);	//delete JamTrackerPackage::Clusters
+	SafeDelete(timeSeriesSamples);	//delete TimeSeriesPackage::Series
+	SafeDelete(detectorCounters);	//delete DetectorArrayPackage::Counters
+	if (liveStateSlot >= 0) {
+		LiveState->Release(liveStateSlot);
+	}
 	if (!deletedPedalChnage) {
 		delete PedalChnage;		//delete PedalChangePackage
 		deletedPedalChnage = true;
@@ -35,107 +90,363 @@ AdvanceTimeAndMeasureClass::~AdvanceTimeAndMeasureClass() {
 }
 
 void AdvanceTimeAndMeasureClass::AdvanceTimeAndMeasure() {
-	RunUp();
+	//Resume from the checkpoint if the simulation of this N was interrupted.
+	if (!LoadCheckpoint()) {
+		//The run-up is skipped when the state after it is cached.
+		if (LoadRunUpState()) {
+			phase = PhaseType::Measure;
+		}
+	}
+	lastCheckpointTime = std::chrono::steady_clock::now();
+	if (phase == PhaseType::RunUp) {
+		RunUp();
+		if (_interrupted) {
+			return;
+		}
+		StoreRunUpState();
+		phase = PhaseType::Measure;
+		elapsed = 0;
+		measureNumber = 0;
+	}
 	Measure();
+	if (!_interrupted && Checkpoint != nullptr) {
+		Checkpoint->Remove(N);
+	}
+}
+
+/*
+	Start the simulation of this N over as the retry "Attempt" with a new seed, reusing the parameters and the allocated objects.
+	This is called when the simulation failed, so the checkpoint of the failed attempt is discarded.
+*/
+bool AdvanceTimeAndMeasureClass::Reinitialize(const int& Attempt, const unsigned int& Seed) {
+	if (Checkpoint != nullptr) {
+		Checkpoint->Remove(N);
+	}
+	if (SnapShotWriter != nullptr) {
+		SnapShotWriter->Discard();
+	}
+	for (std::size_t i = 0; i < cars->size(); i++) {
+		SafeDelete((*cars)[i]);	//delete CarStruct
+	}
+	random->Reseed(Seed);
+	_attempt = Attempt;
+	if (flightRecorderRing != nullptr) {
+		flightRecorderRing->Clear();
+	}
+	if (detectorCounters != nullptr) {
+		detectorCounters->Clear();
+	}
+	_interrupted = false;
+	_succedMeasure = false;
+	phase = PhaseType::RunUp;
+	elapsed = 0;
+	measureNumber = 0;
+	Initialize();
+	return _initializeSuccess;
 }
 
 const StatisticsClass* const AdvanceTimeAndMeasureClass::Statistics() const {
 	return statistics;
 }
 
-void AdvanceTimeAndMeasureClass::Initialize(const std::string& IniFileFolderPath, const int& IniFileNumber) {
-	//Load the ini file and initialize the model calculation conditions and parameters for each vehicle.
-	InitializerClass initializer(IniFileFolderPath, IniFileNumber, this);
+/*
+	nullptr if there is no detector other than that of "Statistics Parameters".
+*/
+const DetectorArrayPackage::Counters* AdvanceTimeAndMeasureClass::DetectorCounters() const {
+	return detectorCounters;
+}
+
+/*
+	Number of the time steps that waited for the snapshot writer thread.
+*/
+long long AdvanceTimeAndMeasureClass::SnapShotStallCount() const {
+	return SnapShotWriter == nullptr ? 0 : SnapShotWriter->StallCount();
+}
+
+/*
+	s (wall-clock time)
+*/
+double AdvanceTimeAndMeasureClass::SnapShotStallTime() const {
+	return SnapShotWriter == nullptr ? 0 : SnapShotWriter->StallTime();
+}
+
+/*
+	The compression ratios of the snapshots. Empty if there is nothing to report.
+*/
+std::string AdvanceTimeAndMeasureClass::SnapShotReport() const {
+	return SnapShotWriter == nullptr ? std::string() : SnapShotWriter->Report();
+}
+
+void AdvanceTimeAndMeasureClass::Initialize() {
+	//Initialize the model calculation conditions and parameters for each vehicle from the profiles.
+	InitializerClass initializer(ProfileParameters, this);
 	_initializeSuccess = initializer.Initialize();
 	if (_initializeSuccess) {
-		statistics = new StatisticsClass(N, initializer.GlobalK, StatisticsParameters);
-		DecideDriverTargetAcceleration = new DecideDriverTargetAccelerationClass(PedalChnage, this);
-		UpdatePosition = new UpdatePositionClass(statistics, PedalChnage, this);
+		//The objects of the previous attempt are reused, because they do not depend on the seed.
+		if (statistics == nullptr) {
+			statistics = new StatisticsClass(N, initializer.GlobalK, StatisticsParameters);
+			DecideDriverTargetAcceleration = new DecideDriverTargetAccelerationClass(PedalChnage, this);
+			UpdatePosition = new UpdatePositionClass(statistics, detectorCounters, PedalChnage, this);
+		}
+		else {
+			statistics->Clear();
+		}
 	}
 }
 
 void AdvanceTimeAndMeasureClass::RunUp() {
-	double elapsed = 0;
 	while (elapsed < ModelParameters.RunUpTime) {
+		if (CheckCheckpoint(true, false)) {
+			return;
+		}
 		AdvaceTime();
 		if (!_succedMeasure) {
+			RecordFailure();
 			return;
 		}
 		elapsed += ModelParameters.deltaT;
+		PublishLiveState();
 	}
 }
 
+/*
+	Record where and between which cars the simulation failed.
+*/
+void AdvanceTimeAndMeasureClass::RecordFailure() {
+	switch (phase) {
+	case PhaseType::RunUp:
+		_failure.Phase = "RunUp";
+		_failure.MeasureNumber = 0;
+		break;
+	case PhaseType::Measure:
+		_failure.Phase = "Measure";
+		_failure.MeasureNumber = measureNumber + 1;
+		break;
+	default:
+		break;
+	}
+	_failure.Time = elapsed + ModelParameters.deltaT;
+	_failure.Step = (long long)std::llround(_failure.Time / ModelParameters.deltaT);
+	_failure.IDs = minusGapIDs;
+	DumpFlightRecorder();
+}
+
+/*
+	Write the last time steps and the state at the failure.
+	The car numbers are 1-based as in the snapshots.
+*/
+void AdvanceTimeAndMeasureClass::DumpFlightRecorder() const {
+	if (flightRecorderRing == nullptr) {
+		return;
+	}
+	std::stringstream metadata;
+	metadata << "Failure Phase=" << _failure.Phase << " MeasureN=" << _failure.MeasureNumber << " Step=" << _failure.Step << " Time=" << DoubleFormat::Text(_failure.Time) << " Seed=" << random->Seed() << " CarNs=";
+	for (std::size_t i = 0; i < _failure.IDs.size(); i++) {
+		metadata << (i > 0 ? " " : "") << _failure.IDs[i] + 1;
+	}
+	std::stringstream state;
+	const ModelStateClass modelState(this);
+	modelState.Write(state);
+	FlightRecorder->Dump(*flightRecorderRing, N, random->Seed(), metadata.str(), state.str());
+}
+
+/*
+	Restore the state after the run-up from the cache.
+*/
+bool AdvanceTimeAndMeasureClass::LoadRunUpState() {
+	if (RunUpCache == nullptr) {
+		return false;
+	}
+	const ModelStateClass state(this);
+	if (!RunUpCache->Load(RunUpCache->CreateKey(N, random->Seed()), state)) {
+		return false;
+	}
+	_succedMeasure = true;
+	return true;
+}
+
+/*
+	Save the state after the run-up to the cache.
+*/
+void AdvanceTimeAndMeasureClass::StoreRunUpState() const {
+	if (RunUpCache == nullptr || !_succedMeasure) {
+		return;
+	}
+	const ModelStateClass state(this);
+	RunUpCache->Store(RunUpCache->CreateKey(N, random->Seed()), state);
+}
+
+/*
+	Resume the interrupted simulation from the checkpoint.
+	A checkpoint that cannot be restored is removed, and the simulation is started over so that the model is not left half overwritten.
+*/
+bool AdvanceTimeAndMeasureClass::LoadCheckpoint() {
+	std::string payload;
+	if (Checkpoint == nullptr || !Checkpoint->Load(N, payload)) {
+		return false;
+	}
+	const int attempt = _attempt;
+	const unsigned int seed = random->Seed();
+	std::stringstream SS(payload);
+	std::int32_t savedAttempt;
+	std::uint32_t savedSeed;
+	std::int32_t savedPhase;
+	BinaryIO::Read(SS, savedAttempt);
+	BinaryIO::Read(SS, savedSeed);
+	BinaryIO::Read(SS, savedPhase);
+	BinaryIO::Read(SS, elapsed);
+	BinaryIO::Read(SS, measureNumber);
+	BinaryIO::Read(SS, _succedMeasure);
+	//The seed of the attempt is set before the state of the generator is restored, so that it is reported and cached as that of the trajectory.
+	random->Reseed(savedSeed);
+	const ModelStateClass state(this);
+	if (!state.Read(SS) || !statistics->Read(SS) || (detectorCounters != nullptr && !detectorCounters->Read(SS))) {
+		//The payload has been verified by its checksum, so this happens only when the format is different.
+		Checkpoint->Remove(N);
+		Reinitialize(attempt, seed);
+		return false;
+	}
+	_attempt = savedAttempt;
+	phase = PhaseType(savedPhase);
+	return true;
+}
+
+void AdvanceTimeAndMeasureClass::SaveCheckpoint() {
+	std::stringstream SS;
+	BinaryIO::Write(SS, std::int32_t(_attempt));
+	BinaryIO::Write(SS, std::uint32_t(random->Seed()));
+	BinaryIO::Write(SS, std::int32_t(phase));
+	BinaryIO::Write(SS, elapsed);
+	BinaryIO::Write(SS, measureNumber);
+	BinaryIO::Write(SS, _succedMeasure);
+	const ModelStateClass state(this);
+	state.Write(SS);
+	statistics->Write(SS);
+	if (detectorCounters != nullptr) {
+		detectorCounters->Write(SS);
+	}
+	Checkpoint->Save(N, SS.str());
+	lastCheckpointTime = std::chrono::steady_clock::now();
+}
+
+/*
+	Save the checkpoint if it is due. If SIGINT or SIGTERM has been received, return true so that the simulation stops.
+	"canSave" is false while a snapshot file is being written, because the snapshot already written cannot be rolled back.
+*/
+bool AdvanceTimeAndMeasureClass::CheckCheckpoint(const bool& canSave, const bool& force) {
+	if (Checkpoint == nullptr) {
+		return false;
+	}
+	const bool&& interrupted = InterruptHandler::Requested();
+	if (canSave) {
+		const std::chrono::duration<double>&& sinceLast = std::chrono::steady_clock::now() - lastCheckpointTime;
+		if (force || interrupted || sinceLast.count() >= Checkpoint->Interval) {
+			SaveCheckpoint();
+		}
+	}
+	if (interrupted) {
+		_interrupted = true;
+	}
+	return interrupted;
+}
+
 void AdvanceTimeAndMeasureClass::Measure() {
-	double elapsed;
-	if (CreateSnapShot) {
-		for (int i = 0; i < StatisticsParameters.NumberOfMeasurements; i++) {
-			elapsed = 0;
+	//When the snapshot, the field, the clusters or the time series are written, the start of each measurement is the only point that a checkpoint can be taken.
+	const bool&& writesMeasurement = CreateSnapShot || fieldGrid != nullptr || jamClusters != nullptr || timeSeriesSamples != nullptr;
+	for (; measureNumber < StatisticsParameters.NumberOfMeasurements; measureNumber++) {
+		if (elapsed == 0) {
 			statistics->Reset();
-
-			std::ofstream ofs(GetSnapShotCSVName(i + 1), std::ios::app);
-			ofs << "time";
-			for (int j = 1; j <= N; j++) {
-				ofs << ",N" << std::to_string(j);
+			if (CheckCheckpoint(true, writesMeasurement)) {
+				return;
 			}
-			ofs << std::endl;
-
-			ofs << elapsed;
-			for (std::size_t j = 0; j < cars->size(); j++) {
-				ofs << "," << (*cars)[j]->Moment->x;
+			if (fieldGrid != nullptr) {
+				fieldGrid->Clear();
+			}
+			if (jamClusters != nullptr) {
+				jamClusters->Clear();
+			}
+			if (timeSeriesSamples != nullptr) {
+				timeSeriesSamples->Clear();
 			}
-			ofs << std::endl;
-			while (elapsed < StatisticsParameters.UnitMeasurementTime) {
-				const std::string&& snapShot = AdvaceTime();
-				if (!_succedMeasure) {
-					return;
+			if (detectorCounters != nullptr) {
+				//The next detector of each car is found from the positions, so that the results do not depend on whether the run-up was cached.
+				if (measureNumber == 0) {
+					detectorCounters->Start(*cars);
 				}
-				elapsed += ModelParameters.deltaT;
-				statistics->AddGlobal_dX(global_dX);
-				ofs << elapsed << "," << snapShot << std::endl;
+				detectorCounters->StartMeasurement(measureNumber + 1);
+			}
+			if (CreateSnapShot) {
+				SnapShotWriter->Open(GetSnapShotFileName(measureNumber + 1), measureNumber + 1);
+				SnapShotWriter->WriteFrame(elapsed, *cars, stepAccelerations);
 			}
-			ofs.close();
-			statistics->CalculateAndAddLocalStatistics();
 		}
-		statistics->CalculateAndSetGlobalStatistics();
-	}
-	else {
-		for (int i = 0; i < StatisticsParameters.NumberOfMeasurements; i++) {
-			elapsed = 0;
-			statistics->Reset();
-			while (elapsed < StatisticsParameters.UnitMeasurementTime) {
-				AdvaceTime();
-				if (!_succedMeasure) {
-					return;
+		while (elapsed < StatisticsParameters.UnitMeasurementTime) {
+			if (elapsed > 0 && CheckCheckpoint(!writesMeasurement, false)) {
+				if (CreateSnapShot) {
+					SnapShotWriter->Discard();	//The measurement is repeated when it is resumed.
+				}
+				return;
+			}
+			AdvaceTime();
+			if (!_succedMeasure) {
+				RecordFailure();
+				if (CreateSnapShot) {
+					SnapShotWriter->Discard();
 				}
-				elapsed += ModelParameters.deltaT;
-				statistics->AddGlobal_dX(global_dX);
+				return;
+			}
+			elapsed += ModelParameters.deltaT;
+			statistics->AddGlobal_dX(global_dX);
+			if (timeSeriesSamples != nullptr) {
+				timeSeriesSamples->EndStep(*cars, global_dX);
 			}
-			statistics->CalculateAndAddLocalStatistics();
+			if (CreateSnapShot) {
+				SnapShotWriter->WriteFrame(elapsed, *cars, stepAccelerations);
+			}
+			PublishLiveState();
+		}
+		if (CreateSnapShot) {
+			SnapShotWriter->Close();
+		}
+		if (fieldGrid != nullptr) {
+			SpaceTimeField->Write(*fieldGrid, N, measureNumber + 1);
 		}
-		statistics->CalculateAndSetGlobalStatistics();
+		if (jamClusters != nullptr) {
+			jamClusters->EndMeasurement();
+			JamTracker->Write(*jamClusters, N, measureNumber + 1);
+		}
+		if (timeSeriesSamples != nullptr) {
+			TimeSeries->Write(*timeSeriesSamples, N, measureNumber + 1);
+		}
+		if (detectorCounters != nullptr) {
+			detectorCounters->EndMeasurement();
+		}
+		statistics->CalculateAndAddLocalStatistics();
+		elapsed = 0;
 	}
+	statistics->CalculateAndSetGlobalStatistics();
 }
 
 /*
 	Advance the model one time step.
 */
-std::string AdvanceTimeAndMeasureClass::AdvaceTime() {
+void AdvanceTimeAndMeasureClass::AdvaceTime() {
 	global_dX = 0;
 	int countMinusGap = 0;
 	double rearX;
 	int checked = 0;
 	int updated = 0;
-	std::stringstream snapShot;
+	minusGapIDs.clear();
 	for (std::size_t i = 0; i < std::size_t(N); i++) {
 		const CarStruct* const car = (*cars)[i];
 		DecideDriverTargetAcceleration->DecideDriverTargetAcceleration(car);	//calculate by Eq.(4-12)
 		UpdatePosition->UpdateCarPosition(car);
 		global_dX += UpdatePosition->dX;
-		if (CreateSnapShot) {
-			if (i > 0) {
-				snapShot << ",";
-			}
-			snapShot << UpdatePosition->Position;
+		if (!stepAccelerations.empty()) {
+			stepAccelerations[i] = UpdatePosition->A;
+		}
+		if (fieldGrid != nullptr && phase == PhaseType::Measure) {
+			fieldGrid->Add(car->Moment->x, UpdatePosition->dX);
 		}
 
 		//Check Collision and Update reference informations
@@ -151,6 +462,8 @@ std::string AdvanceTimeAndMeasureClass::AdvaceTime() {
 			}
 			if (rearX < carMoment->x) {
 				countMinusGap++;
+				minusGapIDs.emplace_back(frontID);
+				minusGapIDs.emplace_back(i);
 			}
 			checked++;
 
@@ -169,6 +482,8 @@ std::string AdvanceTimeAndMeasureClass::AdvaceTime() {
 			}
 			if (rearX < rear->Moment->x) {
 				countMinusGap++;
+				minusGapIDs.emplace_back(i);
+				minusGapIDs.emplace_back(rearID);
 			}
 			checked++;
 
@@ -185,6 +500,18 @@ std::string AdvanceTimeAndMeasureClass::AdvaceTime() {
 			updated++;
 		}
 	}
+	if (flightRecorderRing != nullptr) {
+		flightRecorderRing->Record(*cars, stepAccelerations);
+	}
+	if (fieldGrid != nullptr && phase == PhaseType::Measure) {
+		fieldGrid->EndStep();
+	}
+	if (jamClusters != nullptr && phase == PhaseType::Measure) {
+		jamClusters->EndStep(*cars);
+	}
+	if (detectorCounters != nullptr) {
+		detectorCounters->EndStep();
+	}
 	if (checked != N || updated != N) {
 		_succedMeasure = false;
 	}
@@ -196,23 +523,62 @@ std::string AdvanceTimeAndMeasureClass::AdvaceTime() {
 			_succedMeasure = false;
 		}
 	}
+}
 
-	return snapShot.str();
+/*
+	Update the live state at the interval.
+	The cars are copied to the shared memory without waiting for the readers.
+*/
+void AdvanceTimeAndMeasureClass::PublishLiveState() {
+	if (liveStateSlot < 0 || ++liveStateSteps < LiveState->Interval) {
+		return;
+	}
+	liveStateSteps = 0;
+	LiveStatePackage::Progress progress;
+	progress.Phase = phase == PhaseType::RunUp ? 0 : 1;
+	progress.MeasureNumber = phase == PhaseType::RunUp ? 0 : measureNumber + 1;
+	progress.CompletedMeasurements = statistics->CompletedMeasurements();
+	progress.Step = (long long)std::llround(elapsed / ModelParameters.deltaT);
+	progress.Time = elapsed;
+	progress.Counter = phase == PhaseType::RunUp ? 0 : statistics->CurrentCounter();
+	progress.LocalV = phase == PhaseType::RunUp ? 0 : statistics->CurrentLocalVelocity();
+	LiveState->Publish(liveStateSlot, progress, *cars, stepAccelerations);
 }
 
-std::string AdvanceTimeAndMeasureClass::GetSnapShotCSVName(const int& MeasureNumber) {
-	return SnapShotFileNameBase + "_MeasureN" + std::to_string(MeasureNumber) + ".csv";
+std::string AdvanceTimeAndMeasureClass::GetSnapShotFileName(const int& MeasureNumber) {
+	return SnapShotFileNameBase + "_MeasureN" + std::to_string(MeasureNumber) + SnapShotWriter->Extension();
 }
 
 void AdvanceTimeAndMeasureClass::InitializeProperties(AdvanceTimeAndMeasureClass* const thisPtr) {
 	InitializeSuccess(std::bind(&AdvanceTimeAndMeasureClass::Get_InitializeSuccess, thisPtr));
+	Attempt(std::bind(&AdvanceTimeAndMeasureClass::Get_Attempt, thisPtr));
+	CurrentSeed(std::bind(&AdvanceTimeAndMeasureClass::Get_CurrentSeed, thisPtr));
 	SuccedMeasure(std::bind(&AdvanceTimeAndMeasureClass::Get_SuccedMeasure, thisPtr));
+	Interrupted(std::bind(&AdvanceTimeAndMeasureClass::Get_Interrupted, thisPtr));
+	Failure(std::bind(&AdvanceTimeAndMeasureClass::Get_Failure, thisPtr));
 }
 
 const bool& AdvanceTimeAndMeasureClass::Get_InitializeSuccess() const {
 	return _initializeSuccess;
 }
 
+const int& AdvanceTimeAndMeasureClass::Get_Attempt() const {
+	return _attempt;
+}
+
+const unsigned int& AdvanceTimeAndMeasureClass::Get_CurrentSeed() const {
+	return random->Seed();
+}
+
 const bool& AdvanceTimeAndMeasureClass::Get_SuccedMeasure() const {
 	return _succedMeasure;
 }
+
+const bool& AdvanceTimeAndMeasureClass::Get_Interrupted() const {
+	return _interrupted;
+}
+
+
+const AdvanceTimeAndMeasureClass::FailureInformation& AdvanceTimeAndMeasureClass::Get_Failure() const {
+	return _failure;
+}
\ No newline at end of file
@@ -5,27 +5,86 @@
 
 #ifndef ADVANCETIMEANDMEASURECLASS_H
 #define ADVANCETIMEANDMEASURECLASS_H
+#include <chrono>
+#include <cmath>
 #include <fstream>
 #include <sstream>
+#include <stdexcept>
+#include <vector>
 #include "ReadOnlyPropertyClass.h"
 #include "ModelBaseClass.h"
 #include "InitializerClass.h"
 #include "DecideDriverTargetAccelerationClass.h"
 #include "UpdatePositionClass.h"
+#include "ModelStateClass.h"
+#include "RunUpCachePackage.h"
+#include "CheckpointPackage.h"
+#include "InterruptHandlerPackage.h"
+#include "SnapShotWriterPackage.h"
+#include "FlightRecorderPackage.h"
+#include "SpaceTimeFieldPackage.h"
+#include "JamTrackerPackage.h"
+#include "TimeSeriesPackage.h"
+#include "DetectorArrayPackage.h"
+#include "LiveStatePackage.h"
 
 class AdvanceTimeAndMeasureClass : public ModelBaseClass {
 public:
-	AdvanceTimeAndMeasureClass(const std::string& IniFileFolderPath, const int& IniFileNumber, const int& N, const ModelParametersClass& ModelParameters, const StatisticsParametersClass& StatisticsParameters, const bool& CreateSnapShot, const int& RunNumber, const std::string& SnapShotFolderPath);	//constructor
+	AdvanceTimeAndMeasureClass(const ProfileParametersClass& ProfileParameters, const int& N, const ModelParametersClass& ModelParameters, const StatisticsParametersClass& StatisticsParameters, const bool& CreateSnapShot, const int& RunNumber, const unsigned int& Seed, const std::string& SnapShotFolderPath, SnapShotArchivePackage* const SnapShotArchive, const RunUpCachePackage* const RunUpCache, const CheckpointPackage* const Checkpoint, const FlightRecorderPackage* const FlightRecorder, const SpaceTimeFieldPackage* const SpaceTimeField, const JamTrackerPackage* const JamTracker, const TimeSeriesPackage* const TimeSeries, const DetectorArrayPackage* const DetectorArray, LiveStatePackage* const LiveState);	//constructor
 	~AdvanceTimeAndMeasureClass();	//destructor
 
 	void AdvanceTimeAndMeasure();
+	bool Reinitialize(const int& Attempt, const unsigned int& Seed);	//Start the simulation of this N over as the retry "Attempt" with a new seed, reusing the parameters and the allocated objects.
 	const StatisticsClass* const Statistics() const;
+	const DetectorArrayPackage::Counters* DetectorCounters() const;	//nullptr if there is no detector other than that of "Statistics Parameters".
+	long long SnapShotStallCount() const;	//Number of the time steps that waited for the snapshot writer thread.
+	double SnapShotStallTime() const;	//s (wall-clock time)
+	std::string SnapShotReport() const;	//The compression ratios of the snapshots. Empty if there is nothing to report.
+
+	//Where and between which cars the simulation failed.
+	struct FailureInformation {
+		std::string Phase;	//"RunUp" or "Measure"
+		int MeasureNumber;	//1-based, 0 during the run-up
+		long long Step;	//Time step within the phase, 1-based
+		double Time;	//s, elapsed time within the phase
+		std::vector<std::size_t> IDs;	//Pairs of the front and rear cars whose gap became negative. Empty if only the order of the cars was broken.
+	};
 private:
+	const ProfileParametersClass& ProfileParameters;
 	const bool CreateSnapShot;
 	std::string SnapShotFileNameBase;
+	SnapShotWriterPackage* SnapShotWriter;	//nullptr if the snapshots are not created.
+	std::vector<double> stepAccelerations;	//The acceleration of each car used in the last time step, which is recorded in the snapshots, the flight recorder and the live state. Empty if none of them is used.
+	const RunUpCachePackage* const RunUpCache;	//nullptr if the run-up cache is disabled.
+	const CheckpointPackage* const Checkpoint;	//nullptr if the checkpoints are disabled.
+	const FlightRecorderPackage* const FlightRecorder;	//nullptr if the flight recorder is disabled.
+	FlightRecorderPackage::Ring* flightRecorderRing;	//The last time steps of this simulation. nullptr if the flight recorder is disabled.
+	const SpaceTimeFieldPackage* const SpaceTimeField;	//nullptr if the field is not written.
+	SpaceTimeFieldPackage::Grid* fieldGrid;	//The cells of the current measurement. nullptr if the field is not written.
+	const JamTrackerPackage* const JamTracker;	//nullptr if the clusters are not tracked.
+	JamTrackerPackage::Clusters* jamClusters;	//The clusters of the current measurement. nullptr if they are not tracked.
+	const TimeSeriesPackage* const TimeSeries;	//nullptr if the time series is not written.
+	TimeSeriesPackage::Series* timeSeriesSamples;	//The samples of the current measurement. nullptr if the time series is not written.
+	DetectorArrayPackage::Counters* detectorCounters;	//nullptr if there is no detector other than that of "Statistics Parameters".
+	LiveStatePackage* const LiveState;	//nullptr if the live state is disabled.
+	int liveStateSlot;	//-1 if no slot is free.
+	int liveStateSteps;	//Time steps since the last update of the live state
+
+	enum class PhaseType {
+		RunUp
+		, Measure
+	};
+	PhaseType phase;
+	double elapsed;	//Elapsed time of the run-up, or of the current measurement.
+	int measureNumber;	//Index of the current measurement.
+	std::chrono::steady_clock::time_point lastCheckpointTime;
 
 	bool _initializeSuccess;
+	int _attempt;
 	bool _succedMeasure;
+	bool _interrupted;
+	FailureInformation _failure;
+	std::vector<std::size_t> minusGapIDs;	//Cars whose gap became negative at the last time step.
 
 	const PedalChangePackage* const PedalChnage;
 	DecideDriverTargetAccelerationClass* DecideDriverTargetAcceleration;
@@ -34,19 +93,35 @@ private:
 	double global_dX;
 	bool deletedPedalChnage;
 
-	void Initialize(const std::string& IniFileFolderPath, const int& IniFileNumber);
+	void Initialize();
 	void RunUp();
+	void RecordFailure();
+	void DumpFlightRecorder() const;	//Write the last time steps and the state at the failure.
+	bool LoadRunUpState();	//Restore the state after the run-up from the cache.
+	void StoreRunUpState() const;	//Save the state after the run-up to the cache.
+	bool LoadCheckpoint();	//Resume the interrupted simulation from the checkpoint.
+	void SaveCheckpoint();
+	bool CheckCheckpoint(const bool& canSave, const bool& force);	//Save the checkpoint if it is due. If SIGINT or SIGTERM has been received, return true so that the simulation stops.
 	void Measure();
-	std::string AdvaceTime();
-	std::string GetSnapShotCSVName(const int& MeasureNumber);
+	void AdvaceTime();
+	void PublishLiveState();	//Update the live state at the interval.
+	std::string GetSnapShotFileName(const int& MeasureNumber);
 
 	void InitializeProperties(AdvanceTimeAndMeasureClass* const thisPtr);
 
 	const bool& Get_InitializeSuccess() const;
+	const int& Get_Attempt() const;
+	const unsigned int& Get_CurrentSeed() const;
 	const bool& Get_SuccedMeasure() const;
+	const bool& Get_Interrupted() const;
+	const FailureInformation& Get_Failure() const;
 public:
 	ReadOnlyPropertyClass<const bool&> InitializeSuccess;
+	ReadOnlyPropertyClass<const int&> Attempt;	//0 for the first attempt, and the number of the retry after it. It is restored from the checkpoint.
+	ReadOnlyPropertyClass<const unsigned int&> CurrentSeed;	//The seed of the current attempt
 	ReadOnlyPropertyClass<const bool&> SuccedMeasure;
+	ReadOnlyPropertyClass<const bool&> Interrupted;	//Whether the simulation was stopped by SIGINT or SIGTERM before it finished.
+	ReadOnlyPropertyClass<const FailureInformation&> Failure;	//Valid only when "SuccedMeasure" is false.
 };
 
 #endif // !ADVANCETIMEANDMEASURECLASS_H
\ No newline at end of file
@@ -18,8 +18,7 @@ AvoidCollisionPackage::~AvoidCollisionPackage() {
 bool AvoidCollisionPackage::IsEmergency(const CarStruct* const car) const {
 	const CarElements::MomentValues* const carMoment = car->Moment;
 	const DriverElements::EigenValues* const driverEigen = car->Driver->Eigen;
-	const DriverElements::EigenValuesElements::AccelerationSeries* const Deceleration = driverEigen->A->Deceleration;
-	const double& DAcceptable = Deceleration->Acceptable;
+	const double& DAcceptable = driverEigen->DecelerationAcceptable;
 	const double& currentV = carMoment->v;
 	const double& currentVf = carMoment->arround->front->v;
 	const double& currentA = carMoment->a;
@@ -43,7 +42,7 @@ bool AvoidCollisionPackage::IsEmergency(const CarStruct* const car) const {
 		dxF = currentVf * deltaT - 0.5 * DAcceptable * std::pow(deltaT, 2);
 	}
 	const double& tPedalChange = PedalChange->GetAccelToBrakeTime(car, v);
-	const double&& expectedGClosest = v * tPedalChange + 0.5 * std::pow(v, 2) / Deceleration->Strong - 0.5 * std::pow(vf, 2) / DAcceptable + driverEigen->G->Closest;
+	const double&& expectedGClosest = v * tPedalChange + 0.5 * std::pow(v, 2) / car->Driver->Sampled.DecelerationStrong - 0.5 * std::pow(vf, 2) / DAcceptable + driverEigen->G->Closest;
 	const double&& expectedG = carMoment->g->gap + dxF - dx;
 
 	if (expectedG < expectedGClosest) {
@@ -61,17 +60,16 @@ double AvoidCollisionPackage::GetEmergencyAcceleration(const CarStruct* const ca
 	const CarElements::MomentValues* const carMoment = car->Moment;
 	const DriverStruct* const driver = car->Driver;
 	const DriverElements::EigenValues* const driverEigen = driver->Eigen;
-	const DriverElements::EigenValuesElements::AccelerationSeries* const Deceleration = driverEigen->A->Deceleration;
 
 	double dxFront;
 	double nextA;
 	switch (driver->Moment->pedal->footPosition) {
 	case FootPositionType::Brake:
-		dxFront = 0.5 * std::pow(carMoment->arround->front->v, 2) / Deceleration->Acceptable;
+		dxFront = 0.5 * std::pow(carMoment->arround->front->v, 2) / driverEigen->DecelerationAcceptable;
 		nextA = -0.5 * std::pow(carMoment->v, 2) / (carMoment->g->gap + dxFront - driverEigen->G->Closest);
 		break;
 	default:
-		nextA = -Deceleration->Strong;
+		nextA = -driver->Sampled.DecelerationStrong;
 		break;
 	}
 	return nextA;
@@ -0,0 +1,22 @@
+/*
+	This is cpp file of the functions of "BinaryIO" that read and write values of the plain types as binary.
+*/
+
+#include "BinaryIOPackage.h"
+
+void BinaryIO::WriteString(std::ostream& os, const std::string& val) {
+	Write(os, std::uint64_t(val.size()));
+	os.write(val.data(), std::streamsize(val.size()));
+}
+
+bool BinaryIO::ReadString(std::istream& is, std::string& val) {
+	std::uint64_t size;
+	if (!Read(is, size) || size > (std::uint64_t(1) << 32)) {
+		return false;
+	}
+	val.resize(std::size_t(size));
+	if (size > 0) {
+		is.read(&val[0], std::streamsize(size));
+	}
+	return bool(is);
+}
@@ -0,0 +1,28 @@
+/*
+	This is header file of the functions of "BinaryIO" that read and write values of the plain types as binary.
+	These are used by the classes that save the state of the model to a file and load it.
+*/
+
+#ifndef BINARYIOPACKAGE_H
+#define BINARYIOPACKAGE_H
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+namespace BinaryIO {
+	template<typename _T>
+	void Write(std::ostream& os, const _T& val) {
+		os.write(reinterpret_cast<const char*>(&val), sizeof(_T));
+	}
+
+	template<typename _T>
+	bool Read(std::istream& is, _T& val) {
+		is.read(reinterpret_cast<char*>(&val), sizeof(_T));
+		return bool(is);
+	}
+
+	void WriteString(std::ostream& os, const std::string& val);
+	bool ReadString(std::istream& is, std::string& val);
+}
+
+#endif // !BINARYIOPACKAGE_H
@@ -0,0 +1,132 @@
+/*
+	This is cpp file of the class of "CacheFolderPackage" that keeps the entries of a cache as binary files in a folder, which is shared by the caches of the run-up and the results.
+*/
+
+#include "CacheFolderPackage.h"
+
+//constructor
+CacheFolderPackage::CacheFolderPackage(const std::string& FolderPath, const double& MaxSizeMB, const std::string& Magic, const std::string& Extension)
+	: FolderPath(FolderPath), MaxSize(std::uint64_t(MaxSizeMB * 1024 * 1024)), Magic(Magic), Extension(Extension) {
+	FileSystem::MakeDirectories(FolderPath);
+	std::uint64_t size = 0;
+	for (const std::string& name : FileSystem::ListFiles(FolderPath)) {
+		if (IsEntry(name)) {
+			size += std::uint64_t((std::max)(FileSystem::FileSize(FolderPath + R"(/)" + name), std::int64_t(0)));
+		}
+	}
+	totalSize.store(size);
+}
+
+//destructor
+CacheFolderPackage::~CacheFolderPackage() { }
+
+/*
+	Read the payload of the entry after it is verified. If there is no valid entry, return false.
+	The entry is marked as used by its modified time.
+*/
+bool CacheFolderPackage::Load(const std::string& key, std::string& payload) const {
+	const std::string&& path = GetEntryPath(key);
+	std::ifstream ifs(path, std::ios::binary);
+	if (!ifs) {
+		return false;
+	}
+	std::string magic(Magic.size(), '\0');
+	std::string storedKey;
+	std::uint64_t checksum;
+	ifs.read(&magic[0], std::streamsize(magic.size()));
+	if (!ifs || magic != Magic || !BinaryIO::ReadString(ifs, storedKey) || storedKey != key) {
+		return false;
+	}
+	if (!BinaryIO::ReadString(ifs, payload) || !BinaryIO::Read(ifs, checksum)) {
+		return false;
+	}
+	ifs.close();
+	HashPackage hash;
+	hash.Add(payload);
+	if (hash.Value() != checksum) {
+		return false;
+	}
+	FileSystem::TouchFile(path);
+	return true;
+}
+
+/*
+	Save the payload as the entry, and remove the old entries if the cache is too large.
+*/
+void CacheFolderPackage::Store(const std::string& key, const std::string& payload) const {
+	const std::string&& path = GetEntryPath(key);
+	const std::string&& tmpPath = FileSystem::TemporaryPath(path);
+	HashPackage hash;
+	hash.Add(payload);
+
+	std::ofstream ofs(tmpPath, std::ios::binary | std::ios::trunc);
+	if (!ofs) {
+		return;
+	}
+	ofs.write(Magic.data(), std::streamsize(Magic.size()));
+	BinaryIO::WriteString(ofs, key);
+	BinaryIO::WriteString(ofs, payload);
+	BinaryIO::Write(ofs, hash.Value());
+	ofs.close();
+	if (!ofs || !FileSystem::ReplaceFile(tmpPath, path)) {
+		FileSystem::RemoveFile(tmpPath);
+		return;
+	}
+	const std::uint64_t&& size = std::uint64_t((std::max)(FileSystem::FileSize(path), std::int64_t(0)));
+	if (totalSize.fetch_add(size) + size > MaxSize) {
+#ifdef _OPENMP
+#pragma omp critical(CacheFolderCollect)
+#endif // _OPENMP
+		{
+			Collect();
+		}
+	}
+}
+
+bool CacheFolderPackage::IsEntry(const std::string& name) const {
+	return name.size() > Extension.size() && name.compare(name.size() - Extension.size(), Extension.size(), Extension) == 0;
+}
+
+std::string CacheFolderPackage::GetEntryPath(const std::string& key) const {
+	return FolderPath + R"(/)" + key + Extension;
+}
+
+/*
+	Remove the least recently used entries until the cache fits.
+	The entries of all processes are found from the folder, and they are removed down to 3/4 of the maximum size, so that the folder is not listed at every store.
+	An entry removed while another process is reading it is read to the end on POSIX, and the removal fails on Windows.
+*/
+void CacheFolderPackage::Collect() const {
+	struct Entry {
+		std::string path;
+		std::int64_t modifiedTime;
+		std::uint64_t size;
+	};
+	std::vector<Entry> entries;
+	std::uint64_t size = 0;
+	for (const std::string& name : FileSystem::ListFiles(FolderPath)) {
+		if (!IsEntry(name)) {
+			continue;
+		}
+		Entry entry;
+		entry.path = FolderPath + R"(/)" + name;
+		entry.modifiedTime = FileSystem::ModifiedTime(entry.path);
+		const std::int64_t&& fileSize = FileSystem::FileSize(entry.path);
+		if (entry.modifiedTime < 0 || fileSize < 0) {
+			continue;	//It has been removed by another process.
+		}
+		entry.size = std::uint64_t(fileSize);
+		size += entry.size;
+		entries.emplace_back(entry);
+	}
+	if (size > MaxSize) {
+		std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) { return a.modifiedTime < b.modifiedTime; });
+		const std::uint64_t&& target = MaxSize / 4 * 3;
+		for (std::size_t i = 0; i < entries.size() && size > target; i++) {
+			if (FileSystem::RemoveFile(entries[i].path)) {
+				size -= entries[i].size;
+			}
+		}
+	}
+	totalSize.store(size);
+}
@@ -0,0 +1,38 @@
+/*
+	This is header file of the class of "CacheFolderPackage" that keeps the entries of a cache as binary files in a folder, which is shared by the caches of the run-up and the results.
+	An entry is the magic, the key, the payload and the checksum of the payload. It is written to a temporary file and renamed, so the processes and the threads that share the folder never read a broken entry.
+	The total size of the entries is bounded, and the entries that have not been used for the longest time are removed by their modified time.
+*/
+
+#ifndef CACHEFOLDERPACKAGE_H
+#define CACHEFOLDERPACKAGE_H
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "BinaryIOPackage.h"
+#include "FileSystemPackage.h"
+#include "HashPackage.h"
+
+class CacheFolderPackage {
+public:
+	CacheFolderPackage(const std::string& FolderPath, const double& MaxSizeMB, const std::string& Magic, const std::string& Extension);	//constructor. "Magic" is 8 characters, and "Extension" is that of the entries with the dot.
+	~CacheFolderPackage();	//destructor
+
+	bool Load(const std::string& key, std::string& payload) const;	//Read the payload of the entry after it is verified. If there is no valid entry, return false.
+	void Store(const std::string& key, const std::string& payload) const;	//Save the payload as the entry, and remove the old entries if the cache is too large.
+private:
+	const std::string FolderPath;
+	const std::uint64_t MaxSize;
+	const std::string Magic;
+	const std::string Extension;
+	mutable std::atomic<std::uint64_t> totalSize;	//The size known to this process. The other processes are counted when the entries are collected.
+
+	bool IsEntry(const std::string& name) const;
+	std::string GetEntryPath(const std::string& key) const;
+	void Collect() const;	//Remove the least recently used entries until the cache fits.
+};
+
+#endif // !CACHEFOLDERPACKAGE_H
@@ -91,21 +91,16 @@ void CarElements::MomentValues::UpdateReferences() {
 	referenceX = x;
 }
 
-CarStruct::CarStruct()
-	: Eigen(new CarElements::EigenValues())
+CarStruct::CarStruct(const CarElements::EigenValues* const Eigen, const DriverElements::EigenValues* const DriverEigen)
+	: Eigen(Eigen)
 	, Moment(new CarElements::MomentValues())
-	, Driver(new DriverStruct()) { 
+	, Driver(new DriverStruct(DriverEigen)) { 
 	ID = -1;
-	deletedEigen = false;
 	deletedMoment = false;
 	deletedDriver = false;
 }
 
 CarStruct::~CarStruct() {
-	if (Eigen != nullptr && !deletedEigen) {
-		delete Eigen;
-		deletedEigen = true;
-	}
 	if (Moment != nullptr && !deletedMoment) {
 		delete Moment;
 		deletedMoment = true;
@@ -47,7 +47,7 @@ namespace CarElements {
 		};
 	}
 
-	//Vehicle characteristic values.
+	//Vehicle characteristic values. These are the same for all cars, so a single instance is shared by them.
 	struct EigenValues {
 	public:
 		double Vmax;
@@ -90,13 +90,12 @@ namespace CarElements {
 struct CarStruct {
 public:
 	std::size_t ID;
-	CarElements::EigenValues* const Eigen;
+	const CarElements::EigenValues* const Eigen;	//Shared by all cars
 	CarElements::MomentValues* const Moment;
 	DriverStruct* const Driver;
-	CarStruct();
+	CarStruct(const CarElements::EigenValues* const Eigen, const DriverElements::EigenValues* const DriverEigen);
 	~CarStruct();
 private:
-	bool deletedEigen;
 	bool deletedMoment;
 	bool deletedDriver;
 };
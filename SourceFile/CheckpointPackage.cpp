@@ -0,0 +1,99 @@
+/*
+	This is cpp file of the class of "CheckpointPackage" that saves the checkpoints of the simulations in progress to binary files and loads them.
+*/
+
+#include "CheckpointPackage.h"
+
+namespace {
+	const char CheckpointMagic[8] = { 'C', 'T', 'F', 'M', 'C', 'K', 'P', '1' };
+}
+
+//constructor
+CheckpointPackage::CheckpointPackage(const std::string& FolderPath, const int& IniFileNumber, const int& RunNumber, const double& Interval, const std::string& ModelIniFilePath, const std::string& DriverIniFilePath, const std::string& StatisticsIniFilePath, const int& Seed, const int& RetryMaxAttempts)
+	: Interval(Interval) {
+	const std::string&& folderPath = FolderPath + R"(/Ini)" + std::to_string(IniFileNumber);
+	FileSystem::MakeDirectories(folderPath);
+	if (RunNumber == 0) {
+		FileNameBase = folderPath + R"(/Checkpoint)";
+	}
+	else {
+		FileNameBase = folderPath + R"(/Checkpoint)" + "_RunN" + std::to_string(RunNumber);
+	}
+	HashPackage hash;
+	hash.Add(std::uint32_t(CodeVersion));
+	hash.AddFile(ModelIniFilePath);
+	hash.AddFile(DriverIniFilePath);
+	hash.AddFile(StatisticsIniFilePath);
+	//The seed of "Run Parameters" rather than the seed of each N, so that a run with the seed from the current time can still be resumed.
+	hash.Add(std::int32_t(Seed));
+	hash.Add(std::int32_t(RetryMaxAttempts));
+	configHash = hash.Value();
+}
+
+//destructor
+CheckpointPackage::~CheckpointPackage() { }
+
+/*
+	Replace the checkpoint of N atomically.
+*/
+bool CheckpointPackage::Save(const int& N, const std::string& payload) const {
+	const std::string&& path = GetPath(N);
+	const std::string&& tmpPath = FileSystem::TemporaryPath(path);
+	HashPackage hash;
+	hash.Add(payload);
+	std::ofstream ofs(tmpPath, std::ios::binary | std::ios::trunc);
+	if (!ofs) {
+		return false;
+	}
+	ofs.write(CheckpointMagic, sizeof(CheckpointMagic));
+	BinaryIO::Write(ofs, GetKey(N));
+	BinaryIO::WriteString(ofs, payload);
+	BinaryIO::Write(ofs, hash.Value());
+	ofs.close();
+	if (!ofs || !FileSystem::ReplaceFile(tmpPath, path)) {
+		FileSystem::RemoveFile(tmpPath);
+		return false;
+	}
+	return true;
+}
+
+/*
+	If there is no valid checkpoint of N, return false.
+*/
+bool CheckpointPackage::Load(const int& N, std::string& payload) const {
+	std::ifstream ifs(GetPath(N), std::ios::binary);
+	if (!ifs) {
+		return false;
+	}
+	char magic[8];
+	std::uint64_t key;
+	std::uint64_t checksum;
+	ifs.read(magic, sizeof(magic));
+	if (!ifs || !std::equal(magic, magic + sizeof(magic), CheckpointMagic)) {
+		return false;
+	}
+	if (!BinaryIO::Read(ifs, key) || key != GetKey(N) || !BinaryIO::ReadString(ifs, payload) || !BinaryIO::Read(ifs, checksum)) {
+		return false;
+	}
+	HashPackage hash;
+	hash.Add(payload);
+	return hash.Value() == checksum;
+}
+
+/*
+	Remove the checkpoint of N when the simulation has been finished.
+*/
+void CheckpointPackage::Remove(const int& N) const {
+	FileSystem::RemoveFile(GetPath(N));
+}
+
+std::string CheckpointPackage::GetPath(const int& N) const {
+	return FileNameBase + "_N" + std::to_string(N) + ".ckp";
+}
+
+std::uint64_t CheckpointPackage::GetKey(const int& N) const {
+	HashPackage hash;
+	hash.Add(configHash);
+	hash.Add(std::int32_t(N));
+	return hash.Value();
+}
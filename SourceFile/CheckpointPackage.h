@@ -0,0 +1,36 @@
+/*
+	This is header file of the class of "CheckpointPackage" that saves the checkpoints of the simulations in progress to binary files and loads them.
+	A checkpoint is written to a temporary file and renamed, so that a crash while writing never breaks the previous checkpoint.
+	Each checkpoint records a hash of the ".ini" files, the seed, the number of the retries and the version of the code, and it is ignored when they have been changed after it was written.
+*/
+
+#ifndef CHECKPOINTPACKAGE_H
+#define CHECKPOINTPACKAGE_H
+#include <algorithm>
+#include <fstream>
+#include <string>
+#include "BinaryIOPackage.h"
+#include "FileSystemPackage.h"
+#include "HashPackage.h"
+
+class CheckpointPackage {
+public:
+	static const std::uint32_t CodeVersion = 2;	//Increase this when the format of the payload changes, so that the old checkpoints are not resumed.
+
+	CheckpointPackage(const std::string& FolderPath, const int& IniFileNumber, const int& RunNumber, const double& Interval, const std::string& ModelIniFilePath, const std::string& DriverIniFilePath, const std::string& StatisticsIniFilePath, const int& Seed, const int& RetryMaxAttempts);	//constructor
+	~CheckpointPackage();	//destructor
+
+	const double Interval;	//s (wall-clock time)
+
+	bool Save(const int& N, const std::string& payload) const;	//Replace the checkpoint of N atomically.
+	bool Load(const int& N, std::string& payload) const;	//If there is no valid checkpoint of N, return false.
+	void Remove(const int& N) const;	//Remove the checkpoint of N when the simulation has been finished.
+private:
+	std::string FileNameBase;
+	std::uint64_t configHash;
+
+	std::string GetPath(const int& N) const;
+	std::uint64_t GetKey(const int& N) const;
+};
+
+#endif // !CHECKPOINTPACKAGE_H
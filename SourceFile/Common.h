@@ -24,6 +24,19 @@ enum class InitialPositionModeType {
 	, Random
 };
 
+enum class SnapShotFormatType {
+	CSV
+	, Binary
+	, EventLog
+	, Compressed
+	, VehicleMajor
+};
+
+enum class SnapShotPrecisionType {
+	Float64
+	, Float32
+};
+
 enum class FootPositionType {
 	Free
 	, Accel
@@ -100,9 +100,8 @@ double DecideDriverTargetAccelerationClass::CalculateNextA(const CarStruct* cons
 	const CarElements::MomentValuesElements::GapSerise* const g = carMoment->g;
 	const DriverStruct* const driver = car->Driver;
 	const DriverElements::MomentValues* const driverMoment = driver->Moment;
-	const DriverElements::EigenValuesElements::AccelerationPackage* const driverEigenA = driver->Eigen->A;
-	const DriverElements::EigenValuesElements::AccelerationSeries* const Acceleration = driverEigenA->Acceleration;
-	const DriverElements::EigenValuesElements::AccelerationSeries* const Deceleration = driverEigenA->Deceleration;
+	const DriverElements::SampledValues& sampled = driver->Sampled;
+	const double& DAcceptable = driver->Eigen->DecelerationAcceptable;
 
 	if (driverMoment->g->emergency) {
 		//Calculated by Eq.(4-12).
@@ -111,7 +110,7 @@ double DecideDriverTargetAccelerationClass::CalculateNextA(const CarStruct* cons
 	else {
 		//Calculated by Eq.(3-13).
 		if (g->gap < g->closest) {
-			nextA = -Deceleration->Acceptable;
+			nextA = -DAcceptable;
 		}
 		else {
 			double amax;
@@ -122,19 +121,19 @@ double DecideDriverTargetAccelerationClass::CalculateNextA(const CarStruct* cons
 					amax = frontA * (1 - fg);
 				}
 				else {
-					amax = std::abs(Acceleration->Acceptable - frontA) * fg + frontA;
+					amax = std::abs(sampled.AccelerationAcceptable - frontA) * fg + frontA;
 				}
 			}
 			else {
 				if (g->gap <= g->cruise) {
-					amax = -1.0 * (Deceleration->Strong - Deceleration->Normal) * fg - Deceleration->Normal;
+					amax = -1.0 * (sampled.DecelerationStrong - sampled.DecelerationNormal) * fg - sampled.DecelerationNormal;
 				}
 				else {
-					amax = (Deceleration->Normal - car->Eigen->AResistance) * fg - Deceleration->Normal;
+					amax = (sampled.DecelerationNormal - car->Eigen->AResistance) * fg - sampled.DecelerationNormal;
 				}
 			}
-			amax = (std::max)(-Deceleration->Acceptable, amax);
-			nextA = (std::min)(amax, Acceleration->Acceptable) * fv;
+			amax = (std::max)(-DAcceptable, amax);
+			nextA = (std::min)(amax, sampled.AccelerationAcceptable) * fv;
 		}
 	}
 	return nextA;
@@ -0,0 +1,349 @@
+/*
+	This is cpp file of the class of "DetectorArrayPackage" that measures the cars with any number of loop coil detectors along the ring, in addition to the detector of "Statistics Parameters".
+*/
+
+#include "DetectorArrayPackage.h"
+
+//constructor
+DetectorArrayPackage::Counters::Counters(const DetectorArrayPackage& Array, const int& N) : array(Array) {
+	next.assign(std::size_t(N), 0);
+	inside.assign(std::size_t(N), 0);
+	elapsed.assign(std::size_t(N), 0);
+	counter.assign(array.sections.size(), 0);
+	transitTime.assign(array.sections.size(), 0);
+	interval.assign(array.sections.size(), 0);
+	active = false;
+	steps = 0;
+	measureNumber = 0;
+}
+
+/*
+	Forget the results when the simulation is started over.
+*/
+void DetectorArrayPackage::Counters::Clear() {
+	active = false;
+	results.clear();
+}
+
+/*
+	Find the next detector of each car when the measurements start.
+	A car on the start of a detector has passed it in the last time step, as the detector of "Statistics Parameters".
+*/
+void DetectorArrayPackage::Counters::Start(const std::vector<CarStruct*>& cars) {
+	const std::vector<Section>& sections = array.sections;
+	for (std::size_t i = 0; i < next.size(); i++) {
+		const double& x = cars[i]->Moment->x;
+		const std::vector<Section>::const_iterator&& it = std::upper_bound(sections.begin(), sections.end(), x, [](const double& x, const Section& section) { return x < section.StartX; });
+		next[i] = it == sections.end() ? 0 : std::uint32_t(it - sections.begin());
+		inside[i] = 0;
+		elapsed[i] = 0;
+	}
+	active = true;
+}
+
+/*
+	1-based
+*/
+void DetectorArrayPackage::Counters::StartMeasurement(const int& MeasureNumber) {
+	std::fill(counter.begin(), counter.end(), 0);
+	std::fill(transitTime.begin(), transitTime.end(), 0.0);
+	std::fill(interval.begin(), interval.end(), 0);
+	steps = 0;
+	measureNumber = MeasureNumber;
+}
+
+/*
+	Move the car from "x" by "dX" with "v" and "a" of the time step.
+	The transit time is calculated as the detector of "Statistics Parameters". A car can pass more than one detector in a time step if they are close.
+*/
+void DetectorArrayPackage::Counters::Update(const std::size_t& ID, const double& x, const double& dX, const double& v, const double& a) {
+	if (!active) {
+		return;
+	}
+	std::uint32_t& d = next[ID];
+	double travelled = 0;	//m, the boundaries before this have been passed in this time step.
+	bool entered = false;
+	while (true) {
+		const Section& section = array.sections[d];
+		if (inside[ID] == 0) {
+			const double&& toStart = array.Distance(x, section.StartX);
+			if (!(toStart > travelled && toStart <= dX)) {
+				return;
+			}
+			inside[ID] = 1;
+			elapsed[ID] = Kinematics::ElapsedTime(v, a, dX - toStart);
+			travelled = toStart;
+			entered = true;
+		}
+		const double&& toEnd = array.Distance(x, section.EndX);
+		if (!(toEnd > travelled && toEnd <= dX)) {
+			if (!entered) {
+				elapsed[ID] += array.deltaT;
+			}
+			return;
+		}
+		counter[d]++;
+		transitTime[d] += entered ? Kinematics::ElapsedTime(v, a, section.Length) : elapsed[ID] + Kinematics::ElapsedTime(v, a, toEnd);
+		inside[ID] = 0;
+		elapsed[ID] = 0;
+		d = d + 1 == array.sections.size() ? 0 : d + 1;
+		travelled = toEnd;
+		entered = false;
+	}
+}
+
+/*
+	Advance to the next time step, and end the intervals that have been finished.
+	The time steps after the last interval in a measurement are added to the last interval.
+*/
+void DetectorArrayPackage::Counters::EndStep() {
+	if (!active) {
+		return;
+	}
+	steps++;
+	for (std::size_t d = 0; d < array.sections.size(); d++) {
+		const Section& section = array.sections[d];
+		if (interval[d] + 1 < section.Intervals && steps % section.StepsPerInterval == 0) {
+			EndInterval(d, section.Interval);
+		}
+	}
+}
+
+/*
+	End the last interval of each detector.
+*/
+void DetectorArrayPackage::Counters::EndMeasurement() {
+	const double&& measuredTime = double(steps) * array.deltaT;
+	for (std::size_t d = 0; d < array.sections.size(); d++) {
+		EndInterval(d, measuredTime - double(interval[d]) * array.sections[d].Interval);
+	}
+}
+
+/*
+	Write the cars and the accumulators so that the measurement can be resumed from a checkpoint.
+*/
+void DetectorArrayPackage::Counters::Write(std::ostream& os) const {
+	BinaryIO::Write(os, active);
+	for (std::size_t i = 0; i < next.size(); i++) {
+		BinaryIO::Write(os, next[i]);
+		BinaryIO::Write(os, inside[i]);
+		BinaryIO::Write(os, elapsed[i]);
+	}
+	for (std::size_t d = 0; d < counter.size(); d++) {
+		BinaryIO::Write(os, counter[d]);
+		BinaryIO::Write(os, transitTime[d]);
+		BinaryIO::Write(os, interval[d]);
+	}
+	BinaryIO::Write(os, steps);
+	BinaryIO::Write(os, measureNumber);
+	BinaryIO::Write(os, std::uint64_t(results.size()));
+	for (const Result& result : results) {
+		BinaryIO::Write(os, result.MeasureNumber);
+		BinaryIO::Write(os, result.IntervalNumber);
+		BinaryIO::Write(os, result.Section);
+		BinaryIO::Write(os, result.Counter);
+		BinaryIO::Write(os, result.TransitTime);
+		BinaryIO::Write(os, result.Duration);
+	}
+}
+
+/*
+	Restore the cars and the accumulators written by "Write".
+*/
+bool DetectorArrayPackage::Counters::Read(std::istream& is) {
+	BinaryIO::Read(is, active);
+	for (std::size_t i = 0; i < next.size(); i++) {
+		BinaryIO::Read(is, next[i]);
+		BinaryIO::Read(is, inside[i]);
+		BinaryIO::Read(is, elapsed[i]);
+		if (next[i] >= array.sections.size()) {
+			return false;
+		}
+	}
+	for (std::size_t d = 0; d < counter.size(); d++) {
+		BinaryIO::Read(is, counter[d]);
+		BinaryIO::Read(is, transitTime[d]);
+		BinaryIO::Read(is, interval[d]);
+	}
+	BinaryIO::Read(is, steps);
+	BinaryIO::Read(is, measureNumber);
+	std::uint64_t size = 0;
+	if (!BinaryIO::Read(is, size)) {
+		return false;
+	}
+	results.clear();
+	Result result;
+	for (std::uint64_t i = 0; i < size; i++) {
+		BinaryIO::Read(is, result.MeasureNumber);
+		BinaryIO::Read(is, result.IntervalNumber);
+		BinaryIO::Read(is, result.Section);
+		BinaryIO::Read(is, result.Counter);
+		BinaryIO::Read(is, result.TransitTime);
+		if (!BinaryIO::Read(is, result.Duration) || result.Section >= array.sections.size()) {
+			return false;
+		}
+		results.emplace_back(result);
+	}
+	return bool(is);
+}
+
+void DetectorArrayPackage::Counters::EndInterval(const std::size_t& d, const double& duration) {
+	Result result;
+	result.MeasureNumber = measureNumber;
+	result.IntervalNumber = interval[d] + 1;
+	result.Section = std::uint32_t(d);
+	result.Counter = counter[d];
+	result.TransitTime = transitTime[d];
+	result.Duration = duration;
+	results.emplace_back(result);
+	counter[d] = 0;
+	transitTime[d] = 0;
+	interval[d]++;
+}
+
+//constructor
+DetectorArrayPackage::DetectorArrayPackage(const std::vector<Detector>& Detectors, const int& UnitMeasurementTime, const double& L, const double& deltaT)
+	: L(L), deltaT(deltaT) {
+	for (std::size_t i = 0; i < Detectors.size(); i++) {
+		const Detector& detector = Detectors[i];
+		Section section;
+		section.Number = std::uint32_t(i + 1);
+		section.StartX = detector.StartX;
+		section.Length = detector.Length;
+		section.EndX = detector.StartX + detector.Length;
+		section.Interval = detector.Interval;
+		if (!(section.StartX >= 0) || !(section.Length > 0) || !(section.EndX <= L)) {
+			throw std::invalid_argument("Invalid Detector:" + std::to_string(section.Number) + " (0 <= Position, 0 < Length, Position + Length <= L)");
+		}
+		section.StepsPerInterval = (long long)std::llround(detector.Interval / deltaT);
+		if (section.StepsPerInterval < 1 || std::abs(double(section.StepsPerInterval) * deltaT - detector.Interval) > 1e-9 * detector.Interval) {
+			throw std::invalid_argument("Invalid Detector Interval:" + std::to_string(detector.Interval) + " (a multiple of deltaT)");
+		}
+		section.Intervals = (std::max)(int(std::ceil(UnitMeasurementTime / detector.Interval - 1e-9)), 1);
+		sections.emplace_back(section);
+	}
+	std::sort(sections.begin(), sections.end(), [](const Section& a, const Section& b) { return a.StartX < b.StartX; });
+	for (std::size_t i = 1; i < sections.size(); i++) {
+		if (sections[i].StartX < sections[i - 1].EndX) {
+			throw std::invalid_argument("Invalid Detector:" + std::to_string(sections[i].Number) + " (overlaps the detector " + std::to_string(sections[i - 1].Number) + ")");
+		}
+	}
+}
+
+//destructor
+DetectorArrayPackage::~DetectorArrayPackage() { }
+
+/*
+	"N,Detector,k,Flux,MeasureN,IntervalN" lines of the results
+*/
+std::string DetectorArrayPackage::FDText(const Counters& counters, const int& N, const int& digits) const {
+	std::stringstream SS;
+	Text(SS, counters, N, digits, false);
+	return SS.str();
+}
+
+/*
+	"N,Detector,k,V,MeasureN,IntervalN" lines of the results
+*/
+std::string DetectorArrayPackage::VDText(const Counters& counters, const int& N, const int& digits) const {
+	std::stringstream SS;
+	Text(SS, counters, N, digits, true);
+	return SS.str();
+}
+
+/*
+	Read the lists of the ".ini" file. "none" means no detector.
+	"Lengths" and "Intervals" have a value for each position, or a single value for all of them.
+*/
+std::vector<DetectorArrayPackage::Detector> DetectorArrayPackage::ParseDetectors(const std::string& Positions, const std::string& Lengths, const std::string& Intervals) {
+	std::vector<Detector> detectors;
+	if (Positions == "none") {
+		return detectors;
+	}
+	const std::vector<double>&& positions = ParseList(Positions, "Positions");
+	const std::vector<double>&& lengths = ParseList(Lengths, "Lengths");
+	const std::vector<double>&& intervals = ParseList(Intervals, "Intervals");
+	if (lengths.size() != 1 && lengths.size() != positions.size()) {
+		throw std::invalid_argument("Invalid Detectors Lengths:" + Lengths + " (a value or a value for each position)");
+	}
+	if (intervals.size() != 1 && intervals.size() != positions.size()) {
+		throw std::invalid_argument("Invalid Detectors Intervals:" + Intervals + " (a value or a value for each position)");
+	}
+	for (std::size_t i = 0; i < positions.size(); i++) {
+		Detector detector;
+		detector.StartX = positions[i];
+		detector.Length = lengths[lengths.size() == 1 ? 0 : i];
+		detector.Interval = intervals[intervals.size() == 1 ? 0 : i];
+		detectors.emplace_back(detector);
+	}
+	return detectors;
+}
+
+/*
+	m ahead of "x" to "position" on the ring, in [0, L)
+*/
+double DetectorArrayPackage::Distance(const double& x, const double& position) const {
+	const double&& distance = position - x;
+	return distance < 0 ? distance + L : distance;
+}
+
+/*
+	The results are written for each detector in the order of the ".ini" file.
+	The density is veh/km and the mean speed is km/h, as the detector of "Statistics Parameters". Both are 0 if no car passed the detector.
+*/
+void DetectorArrayPackage::Text(std::ostream& os, const Counters& counters, const int& N, const int& digits, const bool& velocity) const {
+	std::vector<const Counters::Result*> results;
+	for (const Counters::Result& result : counters.results) {
+		results.emplace_back(&result);
+	}
+	std::stable_sort(results.begin(), results.end(), [this](const Counters::Result* a, const Counters::Result* b) { return sections[a->Section].Number < sections[b->Section].Number; });
+	for (const Counters::Result* const result : results) {
+		const Section& section = sections[result->Section];
+		double av = 0;
+		double k = 0;
+		if (result->Counter > 0) {
+			av = section.Length * result->Counter / result->TransitTime;
+			k = 1000 * result->Counter / result->Duration / av;
+		}
+		os << N << "," << section.Number << "," << DoubleFormat::Text(k, digits) << ",";
+		if (velocity) {
+			os << DoubleFormat::Text(Calculate_m_s_To_Km_h(av), digits);
+		}
+		else {
+			os << result->Counter;
+		}
+		os << "," << result->MeasureNumber << "," << result->IntervalNumber << "\n";
+	}
+}
+
+std::vector<double> DetectorArrayPackage::ParseList(const std::string& list, const std::string& name) {
+	std::vector<double> values;
+	std::size_t begin = 0;
+	while (begin < list.size()) {
+		std::size_t end = list.find(',', begin);
+		if (end == std::string::npos) {
+			end = list.size();
+		}
+		const std::string&& item = list.substr(begin, end - begin);
+		begin = end + 1;
+		if (item.empty()) {
+			continue;
+		}
+		std::size_t parsed = 0;
+		double value = 0;
+		try {
+			value = std::stod(item, &parsed);
+		}
+		catch (const std::exception&) {
+			parsed = 0;
+		}
+		if (parsed != item.size()) {
+			throw std::invalid_argument("Invalid Detectors " + name + ":" + list);
+		}
+		values.emplace_back(value);
+	}
+	if (values.empty()) {
+		throw std::invalid_argument("Invalid Detectors " + name + ":" + list);
+	}
+	return values;
+}
@@ -0,0 +1,103 @@
+/*
+	This is header file of the class of "DetectorArrayPackage" that measures the cars with any number of loop coil detectors along the ring, in addition to the detector of "Statistics Parameters".
+	A detector is [Start X, Start X + Length) and counts the cars that leave it and their transit times in each aggregation interval, in the same way as the detector of "Statistics Parameters".
+	The detectors are sorted by the position, and each car keeps the next detector that it reaches, so only that detector is checked for each car at each time step.
+	Each simulation accumulates the detectors into its own "Counters" during the measurements. The intervals start at the start of each measurement, and the last interval ends at its end.
+	The cars that are in a detector when the measurements start are not counted by it, because their transit times are unknown.
+*/
+
+#ifndef DETECTORARRAYPACKAGE_H
+#define DETECTORARRAYPACKAGE_H
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "BinaryIOPackage.h"
+#include "CarStruct.h"
+#include "Common.h"
+#include "DoubleFormatPackage.h"
+#include "KinematicsPackage.h"
+
+class DetectorArrayPackage {
+public:
+	//A detector given by the ".ini" file
+	struct Detector {
+		double StartX;	//m
+		double Length;	//m
+		double Interval;	//s, a multiple of deltaT
+	};
+
+	//The detectors of a simulation
+	class Counters {
+	public:
+		Counters(const DetectorArrayPackage& Array, const int& N);	//constructor. The cars and the detectors are allocated here, so the measurement never allocates except the results.
+
+		void Clear();	//Forget the results when the simulation is started over.
+		void Start(const std::vector<CarStruct*>& cars);	//Find the next detector of each car when the measurements start.
+		void StartMeasurement(const int& MeasureNumber);	//1-based
+		void Update(const std::size_t& ID, const double& x, const double& dX, const double& v, const double& a);	//Move the car from "x" by "dX" with "v" and "a" of the time step.
+		void EndStep();	//Advance to the next time step, and end the intervals that have been finished.
+		void EndMeasurement();	//End the last interval of each detector.
+		void Write(std::ostream& os) const;	//Write the cars and the accumulators so that the measurement can be resumed from a checkpoint.
+		bool Read(std::istream& is);	//Restore the cars and the accumulators written by "Write".
+	private:
+		//The cars passed a detector in an interval
+		struct Result {
+			int MeasureNumber;
+			int IntervalNumber;	//1-based
+			std::uint32_t Section;	//The index of the sorted detectors
+			int Counter;
+			double TransitTime;	//s, the sum of the cars
+			double Duration;	//s
+		};
+
+		const DetectorArrayPackage& array;
+		bool active;	//Only the measurements are counted.
+		std::vector<std::uint32_t> next;	//The next detector of each car
+		std::vector<std::uint8_t> inside;	//Whether each car is in its next detector
+		std::vector<double> elapsed;	//s, the time that each car has been in its next detector
+		std::vector<int> counter;	//The cars of the current interval of each detector
+		std::vector<double> transitTime;	//s
+		std::vector<int> interval;	//The index of the current interval of each detector
+		long long steps;	//Time steps of the current measurement
+		int measureNumber;
+		std::vector<Result> results;
+
+		void EndInterval(const std::size_t& d, const double& duration);
+
+		friend class DetectorArrayPackage;
+	};
+
+	DetectorArrayPackage(const std::vector<Detector>& Detectors, const int& UnitMeasurementTime, const double& L, const double& deltaT);	//constructor. The detectors are sorted, and must not overlap each other.
+	~DetectorArrayPackage();	//destructor
+
+	std::string FDText(const Counters& counters, const int& N, const int& digits) const;	//"N,Detector,k,Flux,MeasureN,IntervalN" lines of the results
+	std::string VDText(const Counters& counters, const int& N, const int& digits) const;	//"N,Detector,k,V,MeasureN,IntervalN" lines of the results
+
+	static std::vector<Detector> ParseDetectors(const std::string& Positions, const std::string& Lengths, const std::string& Intervals);	//Read the lists of the ".ini" file. "none" means no detector.
+private:
+	//A detector sorted by the position
+	struct Section {
+		std::uint32_t Number;	//1-based, the order in the ".ini" file
+		double StartX;
+		double EndX;
+		double Length;
+		double Interval;
+		long long StepsPerInterval;
+		int Intervals;	//Intervals in a measurement
+	};
+
+	std::vector<Section> sections;
+	const double L;
+	const double deltaT;
+
+	double Distance(const double& x, const double& position) const;	//m ahead of "x" to "position" on the ring
+	void Text(std::ostream& os, const Counters& counters, const int& N, const int& digits, const bool& velocity) const;
+	static std::vector<double> ParseList(const std::string& list, const std::string& name);
+};
+
+#endif // !DETECTORARRAYPACKAGE_H
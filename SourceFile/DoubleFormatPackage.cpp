@@ -0,0 +1,483 @@
+/*
+	This is cpp file of the functions of "DoubleFormat" that write a double as text for the CSV files.
+*/
+
+#include "DoubleFormatPackage.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+namespace {
+	const int MantissaBits = 52;
+	const int ExponentBias = 1023;
+	const int Pow5InvBitCount = 125;
+	const int Pow5BitCount = 125;
+	const int Pow5InvTableSize = 342;
+	const int Pow5TableSize = 326;
+	const int ShortestPrecision = 17;	//The shortest digits are written in the exponent form from 1e+17 as "%.17g".
+
+	const char DigitPairs[201] =
+		"00010203040506070809"
+		"10111213141516171819"
+		"20212223242526272829"
+		"30313233343536373839"
+		"40414243444546474849"
+		"50515253545556575859"
+		"60616263646566676869"
+		"70717273747576777879"
+		"80818283848586878889"
+		"90919293949596979899";
+
+	/*
+		The tables of the powers of 5 with 125 significant bits. [0] is the lower 64 bits.
+			Pow5[i]    : 5^i shifted to 125 bits
+			Pow5Inv[i] : 2^(bits of 5^i - 1 + 125) / 5^i + 1
+		They are computed once with the exact integers instead of being pasted.
+	*/
+	class Pow5Table {
+		typedef std::vector<std::uint32_t> BigInteger;	//[0] is the lowest 32 bits.
+
+		static int BitLength(const BigInteger& a) {
+			for (std::size_t i = a.size(); i > 0; i--) {
+				if (a[i - 1] != 0) {
+					int bits = int(i - 1) * 32;
+					for (std::uint32_t word = a[i - 1]; word != 0; word >>= 1) {
+						bits++;
+					}
+					return bits;
+				}
+			}
+			return 0;
+		}
+
+		static bool Bit(const BigInteger& a, const int& i) {
+			return i >= 0 && std::size_t(i / 32) < a.size() && ((a[std::size_t(i / 32)] >> (i % 32)) & 1) != 0;
+		}
+
+		//Bits [shift, shift + 128) of "a". The negative bits are 0.
+		static void Extract128(const BigInteger& a, const int& shift, std::uint64_t(&result)[2]) {
+			result[0] = 0;
+			result[1] = 0;
+			for (int i = 0; i < 128; i++) {
+				if (Bit(a, shift + i)) {
+					result[i / 64] |= std::uint64_t(1) << (i % 64);
+				}
+			}
+		}
+
+		static void MultiplyBy5(BigInteger& a) {
+			std::uint64_t carry = 0;
+			for (std::uint32_t& word : a) {
+				const std::uint64_t&& product = std::uint64_t(word) * 5 + carry;
+				word = std::uint32_t(product);
+				carry = product >> 32;
+			}
+			if (carry != 0) {
+				a.push_back(std::uint32_t(carry));
+			}
+		}
+
+		static BigInteger ShiftLeft(const BigInteger& a, const int& shift) {
+			BigInteger result(a.size() + std::size_t(shift / 32) + 1, 0);
+			for (std::size_t i = 0; i < a.size(); i++) {
+				const std::uint64_t&& word = std::uint64_t(a[i]) << (shift % 32);
+				result[i + std::size_t(shift / 32)] |= std::uint32_t(word);
+				result[i + std::size_t(shift / 32) + 1] |= std::uint32_t(word >> 32);
+			}
+			return result;
+		}
+
+		static void ShiftRight1(BigInteger& a) {
+			for (std::size_t i = 0; i < a.size(); i++) {
+				a[i] = (a[i] >> 1) | (i + 1 < a.size() ? a[i + 1] << 31 : 0);
+			}
+		}
+
+		static bool GreaterEqual(const BigInteger& a, const BigInteger& b) {
+			for (std::size_t i = std::max(a.size(), b.size()); i > 0; i--) {
+				const std::uint32_t&& wordA = i - 1 < a.size() ? a[i - 1] : 0;
+				const std::uint32_t&& wordB = i - 1 < b.size() ? b[i - 1] : 0;
+				if (wordA != wordB) {
+					return wordA > wordB;
+				}
+			}
+			return true;
+		}
+
+		//a -= b (a >= b)
+		static void Subtract(BigInteger& a, const BigInteger& b) {
+			std::int64_t borrow = 0;
+			for (std::size_t i = 0; i < a.size(); i++) {
+				std::int64_t&& difference = std::int64_t(a[i]) - (i < b.size() ? std::int64_t(b[i]) : 0) - borrow;
+				borrow = difference < 0 ? 1 : 0;
+				a[i] = std::uint32_t(difference + (borrow << 32));
+			}
+		}
+	public:
+		std::uint64_t Pow5[Pow5TableSize][2];
+		std::uint64_t Pow5Inv[Pow5InvTableSize][2];
+
+		Pow5Table() {
+			BigInteger pow5(1, 1);
+			for (int i = 0; i < std::max(Pow5TableSize, Pow5InvTableSize); i++) {
+				const int&& bits = BitLength(pow5);
+				if (i < Pow5TableSize) {
+					Extract128(pow5, bits - Pow5BitCount, Pow5[i]);
+				}
+				if (i < Pow5InvTableSize) {
+					//The quotient has at most 126 bits, so it is found bit by bit from the top.
+					const int&& j = bits - 1 + Pow5InvBitCount;
+					BigInteger remainder = ShiftLeft(BigInteger(1, 1), j);
+					BigInteger divisor = ShiftLeft(pow5, 127);
+					BigInteger quotient(4, 0);
+					for (int t = 127; t >= 0; t--) {
+						if (GreaterEqual(remainder, divisor)) {
+							Subtract(remainder, divisor);
+							quotient[std::size_t(t / 32)] |= std::uint32_t(1) << (t % 32);
+						}
+						ShiftRight1(divisor);
+					}
+					Pow5Inv[i][0] = (std::uint64_t(quotient[1]) << 32 | quotient[0]) + 1;
+					Pow5Inv[i][1] = std::uint64_t(quotient[3]) << 32 | quotient[2];
+					if (Pow5Inv[i][0] == 0) {
+						Pow5Inv[i][1]++;
+					}
+				}
+				MultiplyBy5(pow5);
+			}
+		}
+	};
+
+	const Pow5Table& Tables() {
+		static const Pow5Table table;
+		return table;
+	}
+
+	//ceil(log2(5^e)) for 0 < e <= 3528, and 1 for e = 0
+	int Pow5Bits(const int& e) {
+		return int((std::uint32_t(e) * 1217359) >> 19) + 1;
+	}
+
+	//floor(log10(2^e)) for 0 <= e <= 1650
+	std::uint32_t Log10Pow2(const int& e) {
+		return (std::uint32_t(e) * 78913) >> 18;
+	}
+
+	//floor(log10(5^e)) for 0 <= e <= 2620
+	std::uint32_t Log10Pow5(const int& e) {
+		return (std::uint32_t(e) * 732923) >> 20;
+	}
+
+	bool MultipleOfPowerOf5(std::uint64_t value, const std::uint32_t& p) {
+		std::uint32_t count = 0;
+		while (value % 5 == 0 && count < p) {
+			value /= 5;
+			count++;
+		}
+		return count >= p;
+	}
+
+	bool MultipleOfPowerOf2(const std::uint64_t& value, const std::uint32_t& p) {
+		return (value & ((std::uint64_t(1) << p) - 1)) == 0;
+	}
+
+	//The 128-bit product without the compiler extensions
+	std::uint64_t Multiply128(const std::uint64_t& a, const std::uint64_t& b, std::uint64_t& high) {
+		const std::uint64_t&& aLow = a & 0xffffffffu;
+		const std::uint64_t&& aHigh = a >> 32;
+		const std::uint64_t&& bLow = b & 0xffffffffu;
+		const std::uint64_t&& bHigh = b >> 32;
+		const std::uint64_t&& lowLow = aLow * bLow;
+		const std::uint64_t&& middle1 = aHigh * bLow + (lowLow >> 32);
+		const std::uint64_t&& middle2 = aLow * bHigh + (middle1 & 0xffffffffu);
+		high = aHigh * bHigh + (middle1 >> 32) + (middle2 >> 32);
+		return (middle2 << 32) | (lowLow & 0xffffffffu);
+	}
+
+	//(m * mul) >> j for 64 < j < 128
+	std::uint64_t MulShift(const std::uint64_t& m, const std::uint64_t(&mul)[2], const int& j) {
+		std::uint64_t high0;
+		std::uint64_t high1;
+		Multiply128(m, mul[0], high0);
+		const std::uint64_t&& low1 = Multiply128(m, mul[1], high1);
+		const std::uint64_t&& sum = high0 + low1;
+		if (sum < high0) {
+			high1++;
+		}
+		const int&& shift = j - 64;
+		return (high1 << (64 - shift)) | (sum >> shift);
+	}
+
+	int DecimalLength(const std::uint64_t& v) {
+		int length = 1;
+		for (std::uint64_t p = 10; length < 20 && v >= p; p *= 10) {
+			length++;
+		}
+		return length;
+	}
+
+	struct Decimal {
+		std::uint64_t Mantissa;
+		int Exponent;	//The value is Mantissa * 10^Exponent.
+	};
+
+	/*
+		The shortest decimal in the interval of the values that are rounded to the double.
+		If there are some of them, the closest one to the double is chosen.
+	*/
+	Decimal ToDecimal(const std::uint64_t& ieeeMantissa, const std::uint32_t& ieeeExponent) {
+		const Pow5Table& table = Tables();
+		int e2;
+		std::uint64_t m2;
+		if (ieeeExponent == 0) {
+			e2 = 1 - ExponentBias - MantissaBits - 2;
+			m2 = ieeeMantissa;
+		}
+		else {
+			e2 = int(ieeeExponent) - ExponentBias - MantissaBits - 2;
+			m2 = (std::uint64_t(1) << MantissaBits) | ieeeMantissa;
+		}
+		const bool&& acceptBounds = (m2 & 1) == 0;
+		//The interval is [mm, mp] in the unit of 2^e2. mm is closer if the double is a power of 2.
+		const std::uint64_t&& mv = 4 * m2;
+		const std::uint32_t&& mmShift = (ieeeMantissa != 0 || ieeeExponent <= 1) ? 1 : 0;
+		std::uint64_t vr;
+		std::uint64_t vp;
+		std::uint64_t vm;
+		int e10;
+		bool vmIsTrailingZeros = false;
+		bool vrIsTrailingZeros = false;
+		if (e2 >= 0) {
+			const std::uint32_t&& q = Log10Pow2(e2) - (e2 > 3 ? 1 : 0);
+			e10 = int(q);
+			const int&& k = Pow5InvBitCount + Pow5Bits(int(q)) - 1;
+			const int&& i = -e2 + int(q) + k;
+			vr = MulShift(mv, table.Pow5Inv[q], i);
+			vp = MulShift(mv + 2, table.Pow5Inv[q], i);
+			vm = MulShift(mv - 1 - mmShift, table.Pow5Inv[q], i);
+			if (q <= 21) {
+				//Only one of mm, mv and mp can be a multiple of 5.
+				if (mv % 5 == 0) {
+					vrIsTrailingZeros = MultipleOfPowerOf5(mv, q);
+				}
+				else if (acceptBounds) {
+					vmIsTrailingZeros = MultipleOfPowerOf5(mv - 1 - mmShift, q);
+				}
+				else {
+					vp -= MultipleOfPowerOf5(mv + 2, q) ? 1 : 0;
+				}
+			}
+		}
+		else {
+			const std::uint32_t&& q = Log10Pow5(-e2) - (-e2 > 1 ? 1 : 0);
+			e10 = int(q) + e2;
+			const int&& i = -e2 - int(q);
+			const int&& k = Pow5Bits(i) - Pow5BitCount;
+			const int&& j = int(q) - k;
+			vr = MulShift(mv, table.Pow5[i], j);
+			vp = MulShift(mv + 2, table.Pow5[i], j);
+			vm = MulShift(mv - 1 - mmShift, table.Pow5[i], j);
+			if (q <= 1) {
+				//mv has at least 2 trailing zero bits.
+				vrIsTrailingZeros = true;
+				if (acceptBounds) {
+					vmIsTrailingZeros = mmShift == 1;
+				}
+				else {
+					vp--;
+				}
+			}
+			else if (q < 63) {
+				vrIsTrailingZeros = MultipleOfPowerOf2(mv, q);
+			}
+		}
+		//Remove the digits while the interval has a shorter decimal.
+		int removed = 0;
+		std::uint32_t lastRemovedDigit = 0;
+		std::uint64_t output;
+		if (vmIsTrailingZeros || vrIsTrailingZeros) {
+			//The rare case that the bounds or the exact value may be a decimal
+			while (vp / 10 > vm / 10) {
+				vmIsTrailingZeros &= vm % 10 == 0;
+				vrIsTrailingZeros &= lastRemovedDigit == 0;
+				lastRemovedDigit = std::uint32_t(vr % 10);
+				vr /= 10;
+				vp /= 10;
+				vm /= 10;
+				removed++;
+			}
+			if (vmIsTrailingZeros) {
+				while (vm % 10 == 0) {
+					vrIsTrailingZeros &= lastRemovedDigit == 0;
+					lastRemovedDigit = std::uint32_t(vr % 10);
+					vr /= 10;
+					vp /= 10;
+					vm /= 10;
+					removed++;
+				}
+			}
+			if (vrIsTrailingZeros && lastRemovedDigit == 5 && vr % 2 == 0) {
+				lastRemovedDigit = 4;	//Round half to even
+			}
+			output = vr + (((vr == vm && (!acceptBounds || !vmIsTrailingZeros)) || lastRemovedDigit >= 5) ? 1 : 0);
+		}
+		else {
+			bool roundUp = false;
+			if (vp / 100 > vm / 100) {
+				roundUp = vr % 100 >= 50;
+				vr /= 100;
+				vp /= 100;
+				vm /= 100;
+				removed += 2;
+			}
+			while (vp / 10 > vm / 10) {
+				roundUp = vr % 10 >= 5;
+				vr /= 10;
+				vp /= 10;
+				vm /= 10;
+				removed++;
+			}
+			output = vr + ((vr == vm || roundUp) ? 1 : 0);
+		}
+		Decimal result = { output, e10 + removed };
+		while (result.Mantissa % 10 == 0) {
+			result.Mantissa /= 10;
+			result.Exponent++;
+		}
+		return result;
+	}
+
+	//Write the digits of "v" that has "length" digits.
+	void WriteDigits(char* const p, std::uint64_t v, int length) {
+		while (length >= 2) {
+			const std::size_t&& pair = std::size_t(v % 100) * 2;
+			v /= 100;
+			length -= 2;
+			p[length] = DigitPairs[pair];
+			p[length + 1] = DigitPairs[pair + 1];
+		}
+		if (length == 1) {
+			p[0] = char('0' + v);
+		}
+	}
+
+	/*
+		Write the decimal as "%g" does with "precision" digits.
+		The exponent form is used if the exponent is less than -4 or not less than "precision".
+	*/
+	char* WriteDecimal(char* p, const Decimal& decimal, const int& precision) {
+		char digits[20];
+		const int&& length = DecimalLength(decimal.Mantissa);
+		WriteDigits(digits, decimal.Mantissa, length);
+		const int&& x = length + decimal.Exponent - 1;
+		if (x < -4 || x >= precision) {
+			*p++ = digits[0];
+			if (length > 1) {
+				*p++ = '.';
+				std::memcpy(p, digits + 1, std::size_t(length - 1));
+				p += length - 1;
+			}
+			*p++ = 'e';
+			*p++ = x < 0 ? '-' : '+';
+			const int&& exponent = x < 0 ? -x : x;
+			if (exponent >= 100) {
+				*p++ = char('0' + exponent / 100);
+			}
+			*p++ = DigitPairs[(exponent % 100) * 2];
+			*p++ = DigitPairs[(exponent % 100) * 2 + 1];
+		}
+		else if (decimal.Exponent >= 0) {
+			std::memcpy(p, digits, std::size_t(length));
+			p += length;
+			std::memset(p, '0', std::size_t(decimal.Exponent));
+			p += decimal.Exponent;
+		}
+		else if (x >= 0) {
+			std::memcpy(p, digits, std::size_t(x + 1));
+			p += x + 1;
+			*p++ = '.';
+			std::memcpy(p, digits + x + 1, std::size_t(length - x - 1));
+			p += length - x - 1;
+		}
+		else {
+			*p++ = '0';
+			*p++ = '.';
+			std::memset(p, '0', std::size_t(-x - 1));
+			p += -x - 1;
+			std::memcpy(p, digits, std::size_t(length));
+			p += length;
+		}
+		return p;
+	}
+}
+
+/*
+	Write the text to "buffer" that has "BufferSize" bytes, and return the length.
+	If "digits" is positive, the number is rounded to the digits and written as "%.<digits>g".
+	The shortest digits are rounded, which is exact as long as the double has more precision than the digits.
+	When the shortest digits end with a 5 just after the rounded digit, or the double is subnormal, it depends on the digits that are not generated,
+	so only these rare cases are written by "snprintf" with the "C" locale of the program.
+*/
+std::size_t DoubleFormat::Write(char* const buffer, const double& val, const int& digits) {
+	std::uint64_t bits;
+	std::memcpy(&bits, &val, sizeof(bits));
+	const std::uint64_t&& ieeeMantissa = bits & ((std::uint64_t(1) << MantissaBits) - 1);
+	const std::uint32_t&& ieeeExponent = std::uint32_t(bits >> MantissaBits) & 0x7ff;
+	char* p = buffer;
+	if ((bits >> 63) != 0) {
+		*p++ = '-';
+	}
+	if (ieeeExponent == 0x7ff) {
+		std::memcpy(p, ieeeMantissa != 0 ? "nan" : "inf", 3);
+		return std::size_t(p + 3 - buffer);
+	}
+	if (ieeeExponent == 0 && ieeeMantissa == 0) {
+		*p++ = '0';
+		return std::size_t(p - buffer);
+	}
+	if (digits > 0 && ieeeExponent == 0) {
+		return std::size_t(std::snprintf(buffer, BufferSize, "%.*g", digits, val));
+	}
+	Decimal decimal = ToDecimal(ieeeMantissa, ieeeExponent);
+	int precision = ShortestPrecision;
+	if (digits > 0) {
+		precision = digits;
+		const int&& over = DecimalLength(decimal.Mantissa) - digits;
+		if (over > 0) {
+			std::uint64_t scale = 1;
+			for (int i = 0; i < over; i++) {
+				scale *= 10;
+			}
+			const std::uint64_t&& rest = decimal.Mantissa % scale;
+			if (rest == scale / 2) {
+				return std::size_t(std::snprintf(buffer, BufferSize, "%.*g", digits, val));
+			}
+			decimal.Mantissa = decimal.Mantissa / scale + (rest > scale / 2 ? 1 : 0);
+			decimal.Exponent += over;
+			while (decimal.Mantissa % 10 == 0) {
+				decimal.Mantissa /= 10;
+				decimal.Exponent++;
+			}
+		}
+	}
+	return std::size_t(WriteDecimal(p, decimal, precision) - buffer);
+}
+
+void DoubleFormat::Append(std::string& text, const double& val, const int& digits) {
+	char buffer[BufferSize];
+	text.append(buffer, Write(buffer, val, digits));
+}
+
+std::string DoubleFormat::ToString(const double& val, const int& digits) {
+	char buffer[BufferSize];
+	return std::string(buffer, Write(buffer, val, digits));
+}
+
+DoubleFormat::Text::Text(const double& val, const int& digits) {
+	Size = Write(Buffer, val, digits);
+}
+
+std::ostream& operator<<(std::ostream& os, const DoubleFormat::Text& text) {
+	return os.write(text.Buffer, std::streamsize(text.Size));
+}
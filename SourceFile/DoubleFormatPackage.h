@@ -0,0 +1,40 @@
+/*
+	This is header file of the functions of "DoubleFormat" that write a double as text for the CSV files.
+	The shortest digits that are read back to the same double are written, so the positions on a long road keep their precision.
+	The digits are generated from the binary value without iostreams or the locale, and the decimal point is always '.'.
+	A number of significant digits can be given instead, and the number is written as "%.<digits>g" without the trailing zeros.
+
+	reference
+	Ulf Adams
+	Ryu: fast float-to-string conversion
+	PLDI 2018
+*/
+
+#ifndef DOUBLEFORMATPACKAGE_H
+#define DOUBLEFORMATPACKAGE_H
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+namespace DoubleFormat {
+	const int Shortest = 0;	//The significant digits that means the shortest digits read back to the same value
+	const int MaxDigits = 15;	//The significant digits up to this are rounded exactly from the shortest digits.
+	const std::size_t BufferSize = 32;	//Enough for any double
+
+	std::size_t Write(char* const buffer, const double& val, const int& digits = Shortest);	//Write the text to "buffer" that has "BufferSize" bytes, and return the length. It is not terminated by '\0'. "digits" is from "Shortest" to "MaxDigits".
+	void Append(std::string& text, const double& val, const int& digits = Shortest);
+	std::string ToString(const double& val, const int& digits = Shortest);
+
+	//The text of a double for "<<". ex: os << DoubleFormat::Text(x, digits)
+	struct Text {
+		char Buffer[BufferSize];
+		std::size_t Size;
+
+		Text(const double& val, const int& digits = Shortest);
+	};
+}
+
+std::ostream& operator<<(std::ostream& os, const DoubleFormat::Text& text);
+
+#endif // !DOUBLEFORMATPACKAGE_H
@@ -1,35 +1,5 @@
 #include "DriverStruct.h"
 
-DriverElements::EigenValuesElements::AccelerationSeries::AccelerationSeries() {
-	Acceptable = 0;
-	Strong = 0;
-	Normal = 0;
-}
-
-DriverElements::EigenValuesElements::AccelerationPackage::AccelerationPackage()
-	: Acceleration(new AccelerationSeries()) 
-	, Deceleration(new AccelerationSeries())
-	, FrontDeceleration(new AccelerationSeries()) { 
-	deletedAcceleration = false;
-	deletedDeceleration = false;
-	deletedFrontDeceleration = false;
-}
-
-DriverElements::EigenValuesElements::AccelerationPackage::~AccelerationPackage() {
-	if (Acceleration != nullptr && !deletedAcceleration) {
-		delete Acceleration;
-		deletedAcceleration = true;
-	}
-	if (Deceleration != nullptr && !deletedDeceleration) {
-		delete Deceleration;
-		deletedDeceleration = true;
-	}
-	if (FrontDeceleration != nullptr && !deletedFrontDeceleration) {
-		delete FrontDeceleration;
-		deletedFrontDeceleration = true;
-	}
-}
-
 DriverElements::EigenValuesElements::PedalChanging::PedalChanging()
 	: AccelToBrake(new Common::EigenValuesElements::UpperLower())
 	, BrakeToAccel(new Common::EigenValuesElements::UpperLower()) { 
@@ -154,12 +124,11 @@ void DriverElements::MomentValuesElements::GSerise::SetBaseNg(const double& rand
 }
 
 DriverElements::EigenValues::EigenValues()
-	: A(new DriverElements::EigenValuesElements::AccelerationPackage())
-	, PedalChange(new DriverElements::EigenValuesElements::PedalChangingTimeInformations())
+	: PedalChange(new DriverElements::EigenValuesElements::PedalChangingTimeInformations())
 	, TMargin(new DriverElements::EigenValuesElements::TMargin())
 	, V(new DriverElements::EigenValuesElements::VSerise())
 	, G(new Common::EigenValuesElements::GSerise()) {
-	deletedA = false;
+	DecelerationAcceptable = 0;
 	deletedPedalChange = false;
 	deletedTMargin = false;
 	deletedV = false;
@@ -167,10 +136,6 @@ DriverElements::EigenValues::EigenValues()
 }
 
 DriverElements::EigenValues::~EigenValues() {
-	if (A != nullptr && !deletedA) {
-		delete A;
-		deletedA = true;
-	}
 	if (PedalChange != nullptr && !deletedPedalChange) {
 		delete PedalChange;
 		deletedPedalChange = true;
@@ -189,6 +154,13 @@ DriverElements::EigenValues::~EigenValues() {
 	}
 }
 
+DriverElements::SampledValues::SampledValues() {
+	AccelerationAcceptable = 0;
+	DecelerationStrong = 0;
+	DecelerationNormal = 0;
+	FrontDecelerationNormal = 0;
+}
+
 DriverElements::MomentValues::MomentValues()
 	: R(new Common::MomentValuesElements::VelocityGap())
 	, pedal(new DriverElements::MomentValuesElements::PedalInformations())
@@ -221,18 +193,13 @@ DriverElements::MomentValues::~MomentValues() {
 	}
 }
 
-DriverStruct::DriverStruct()
-	: Eigen(new DriverElements::EigenValues())
+DriverStruct::DriverStruct(const DriverElements::EigenValues* const Eigen)
+	: Eigen(Eigen)
 	, Moment(new DriverElements::MomentValues()) { 
-	deletedEigen = false;
 	deletedMoment = false;
 }
 
 DriverStruct::~DriverStruct() {
-	if (Eigen != nullptr && !deletedEigen) {
-		delete Eigen;
-		deletedEigen = true;
-	}
 	if (Moment != nullptr && !deletedMoment) {
 		delete Moment;
 		deletedMoment = true;
@@ -5,27 +5,6 @@
 
 namespace DriverElements {
 	namespace EigenValuesElements {
-		struct AccelerationSeries {
-		public:
-			double Acceptable;
-			double Strong;
-			double Normal;
-			AccelerationSeries();
-		};
-
-		struct AccelerationPackage {
-		public:
-			AccelerationSeries* const Acceleration;
-			AccelerationSeries* const Deceleration;
-			AccelerationSeries* const FrontDeceleration;
-			AccelerationPackage();
-			~AccelerationPackage();
-		private:
-			bool deletedAcceleration;
-			bool deletedDeceleration;
-			bool deletedFrontDeceleration;
-		};
-
 		struct PedalChanging {
 		public:
 			Common::EigenValuesElements::UpperLower* const AccelToBrake;
@@ -116,10 +95,10 @@ namespace DriverElements {
 		};
 	}
 
-	//Eigenvalues that characterize drivers.
+	//Eigenvalues that characterize drivers. These are the same for all drivers, so a single instance is shared by them.
 	struct EigenValues {
 	public:
-		EigenValuesElements::AccelerationPackage* const A;
+		double DecelerationAcceptable;
 		EigenValuesElements::PedalChangingTimeInformations* const PedalChange;
 		EigenValuesElements::TMargin* const TMargin;
 		EigenValuesElements::VSerise* const V;
@@ -127,13 +106,22 @@ namespace DriverElements {
 		EigenValues();
 		~EigenValues();
 	private:
-		bool deletedA;
 		bool deletedPedalChange;
 		bool deletedTMargin;
 		bool deletedV;
 		bool deletedG;
 	};
 
+	//Eigenvalues drawn for each driver. These are stored in the driver itself.
+	struct SampledValues {
+	public:
+		double AccelerationAcceptable;
+		double DecelerationStrong;
+		double DecelerationNormal;
+		double FrontDecelerationNormal;
+		SampledValues();
+	};
+
 	//The value that the driver has while driving, changing from moment to moment.
 	struct MomentValues {
 	public:
@@ -155,12 +143,12 @@ namespace DriverElements {
 
 struct DriverStruct {
 public:
-	DriverElements::EigenValues* const Eigen;
+	const DriverElements::EigenValues* const Eigen;	//Shared by all drivers
+	DriverElements::SampledValues Sampled;
 	DriverElements::MomentValues* const Moment;
-	DriverStruct();
+	DriverStruct(const DriverElements::EigenValues* const Eigen);
 	~DriverStruct();
 private:
-	bool deletedEigen;
 	bool deletedMoment;
 };
 
@@ -0,0 +1,136 @@
+/*
+	This is cpp file of the functions of "FileSystem" that operate on files and folders.
+*/
+
+#include "FileSystemPackage.h"
+#include <atomic>
+#include <sys/stat.h>
+#include <dirent.h>
+#ifdef _WIN32
+#include <direct.h>
+#include <io.h>
+#include <process.h>
+#include <sys/utime.h>
+#else
+#include <unistd.h>
+#include <utime.h>
+#endif // _WIN32
+
+bool FileSystem::Exists(const std::string& path) {
+	struct stat st;
+	return stat(path.c_str(), &st) == 0;
+}
+
+/*
+	Create the folder and all of its parent folders.
+*/
+bool FileSystem::MakeDirectories(const std::string& path) {
+	if (path.empty() || Exists(path)) {
+		return true;
+	}
+	const std::size_t&& ifind = path.find_last_of("/\\");
+	if (ifind != std::string::npos && ifind > 0) {
+		MakeDirectories(path.substr(0, ifind));
+	}
+#ifdef _WIN32
+	_mkdir(path.c_str());
+#else
+	mkdir(path.c_str(), 0755);
+#endif // _WIN32
+	return Exists(path);
+}
+
+/*
+	Rename "from" to "to" atomically. "to" is overwritten if it exists.
+*/
+bool FileSystem::ReplaceFile(const std::string& from, const std::string& to) {
+#ifdef _WIN32
+	//"rename" of Windows fails when "to" exists.
+	std::remove(to.c_str());
+#endif // _WIN32
+	return std::rename(from.c_str(), to.c_str()) == 0;
+}
+
+bool FileSystem::RemoveFile(const std::string& path) {
+	return std::remove(path.c_str()) == 0;
+}
+
+/*
+	-1 if the file does not exist.
+*/
+std::int64_t FileSystem::FileSize(const std::string& path) {
+	struct stat st;
+	if (stat(path.c_str(), &st) != 0) {
+		return -1;
+	}
+	return std::int64_t(st.st_size);
+}
+
+/*
+	s since the epoch. -1 if the file does not exist.
+*/
+std::int64_t FileSystem::ModifiedTime(const std::string& path) {
+	struct stat st;
+	if (stat(path.c_str(), &st) != 0) {
+		return -1;
+	}
+	return std::int64_t(st.st_mtime);
+}
+
+/*
+	Set the modified time to the current time.
+*/
+bool FileSystem::TouchFile(const std::string& path) {
+#ifdef _WIN32
+	return _utime(path.c_str(), nullptr) == 0;
+#else
+	return utime(path.c_str(), nullptr) == 0;
+#endif // _WIN32
+}
+
+/*
+	File names (not paths) in the folder.
+*/
+std::vector<std::string> FileSystem::ListFiles(const std::string& folderPath) {
+	std::vector<std::string> names;
+	DIR* dir = opendir(folderPath.c_str());
+	if (dir == nullptr) {
+		return names;
+	}
+	struct dirent* entry;
+	while ((entry = readdir(dir)) != nullptr) {
+		const std::string name(entry->d_name);
+		if (name != "." && name != "..") {
+			names.emplace_back(name);
+		}
+	}
+	closedir(dir);
+	return names;
+}
+
+/*
+	A path next to "path" which is unique in this process.
+*/
+std::string FileSystem::TemporaryPath(const std::string& path) {
+	static std::atomic<unsigned long> counter(0);
+#ifdef _WIN32
+	const int&& pid = _getpid();
+#else
+	const int&& pid = int(getpid());
+#endif // _WIN32
+	return path + ".tmp" + std::to_string(pid) + "_" + std::to_string(counter++);
+}
+
+/*
+	Flush the buffer and write the file to the disk (fsync).
+*/
+bool FileSystem::SyncFile(std::FILE* file) {
+	if (std::fflush(file) != 0) {
+		return false;
+	}
+#ifdef _WIN32
+	return _commit(_fileno(file)) == 0;
+#else
+	return fsync(fileno(file)) == 0;
+#endif // _WIN32
+}
@@ -0,0 +1,26 @@
+/*
+	This is header file of the functions of "FileSystem" that operate on files and folders.
+	C++11 has no standard library for them, so these absorb the difference between POSIX and Windows.
+*/
+
+#ifndef FILESYSTEMPACKAGE_H
+#define FILESYSTEMPACKAGE_H
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace FileSystem {
+	bool Exists(const std::string& path);
+	bool MakeDirectories(const std::string& path);	//Create the folder and all of its parent folders.
+	bool ReplaceFile(const std::string& from, const std::string& to);	//Rename "from" to "to" atomically. "to" is overwritten if it exists.
+	bool RemoveFile(const std::string& path);
+	std::int64_t FileSize(const std::string& path);	//-1 if the file does not exist.
+	std::int64_t ModifiedTime(const std::string& path);	//s since the epoch. -1 if the file does not exist.
+	bool TouchFile(const std::string& path);	//Set the modified time to the current time.
+	std::vector<std::string> ListFiles(const std::string& folderPath);	//File names (not paths) in the folder.
+	std::string TemporaryPath(const std::string& path);	//A path next to "path" which is unique in this process.
+	bool SyncFile(std::FILE* file);	//Flush the buffer and write the file to the disk (fsync).
+}
+
+#endif // !FILESYSTEMPACKAGE_H
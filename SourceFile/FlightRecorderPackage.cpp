@@ -0,0 +1,111 @@
+/*
+	This is cpp file of the class of "FlightRecorderPackage" that keeps the last time steps of each simulation in a ring, and dumps them when the cars collide.
+*/
+
+#include "FlightRecorderPackage.h"
+
+//constructor
+FlightRecorderPackage::Ring::Ring(const int& N, const int& Steps, const double& deltaT)
+	: N(std::size_t(N)), capacity(std::size_t(Steps)), deltaT(deltaT) {
+	frames.assign(capacity * (1 + 3 * this->N), 0);
+	head = 0;
+	count = 0;
+	steps = 0;
+}
+
+/*
+	Overwrite the oldest frame with the state after the time step.
+	This is called at every time step, so it only copies the values.
+*/
+void FlightRecorderPackage::Ring::Record(const std::vector<CarStruct*>& cars, const std::vector<double>& accelerations) {
+	steps++;
+	if (capacity == 0) {
+		return;
+	}
+	double* const frame = frames.data() + head * (1 + 3 * N);
+	double* const x = frame + 1;
+	double* const v = x + N;
+	double* const a = v + N;
+	frame[0] = double(steps) * deltaT;
+	for (std::size_t i = 0; i < N; i++) {
+		const CarElements::MomentValues* const carMoment = cars[i]->Moment;
+		x[i] = carMoment->x;
+		v[i] = carMoment->v;
+		a[i] = accelerations[i];
+	}
+	head = head + 1 == capacity ? 0 : head + 1;
+	if (count < capacity) {
+		count++;
+	}
+}
+
+/*
+	Forget the frames when the simulation is started over.
+*/
+void FlightRecorderPackage::Ring::Clear() {
+	head = 0;
+	count = 0;
+	steps = 0;
+}
+
+//constructor
+FlightRecorderPackage::FlightRecorderPackage(const std::string& FolderPath, const int& IniFileNumber, const int& RunNumber, const int& Steps, const double& deltaT, const double& L)
+	: Steps(Steps), folderPath(FolderPath + R"(/Ini)" + std::to_string(IniFileNumber)), deltaT(deltaT), L(L) {
+	if (RunNumber == 0) {
+		FileNameBase = folderPath + R"(/FlightRecorder)";
+	}
+	else {
+		FileNameBase = folderPath + R"(/FlightRecorder)" + "_RunN" + std::to_string(RunNumber);
+	}
+}
+
+//destructor
+FlightRecorderPackage::~FlightRecorderPackage() { }
+
+/*
+	Write the frames of the ring from the oldest as a dense snapshot, and the state as ".state".
+	Return the path of the snapshot, or empty if it cannot be written.
+*/
+std::string FlightRecorderPackage::Dump(const Ring& ring, const int& N, const unsigned int& Seed, const std::string& metadata, const std::string& state) const {
+	const std::string&& path = FileNameBase + "_N" + std::to_string(N) + "_Seed" + std::to_string(Seed) + ".snap";
+	SnapShotFile::Header header;
+	header.Encoding = SnapShotFile::Encoding::Dense;
+	header.BlockFrames = 1;
+	header.Resolution = 0;
+	header.Channels = SnapShotFile::AllChannels;
+	header.ValueSize = sizeof(double);
+	header.N = std::uint32_t(ring.N);
+	header.MeasureNumber = 0;
+	header.deltaT = deltaT;
+	header.L = L;
+	header.CarNumbers.resize(ring.N);
+	for (std::size_t i = 0; i < ring.N; i++) {
+		header.CarNumbers[i] = std::uint32_t(i + 1);
+	}
+	header.Metadata = metadata;
+	FileSystem::MakeDirectories(folderPath);	//The folder is created only when a simulation has failed.
+	std::ofstream ofs(path, std::ios::binary | std::ios::trunc);
+	if (!ofs) {
+		return std::string();
+	}
+	SnapShotFile::WriteHeader(ofs, header);
+	const std::uint64_t&& frameSize = SnapShotFile::FrameSize(header);
+	std::uint64_t offset = std::uint64_t(ofs.tellp());
+	std::vector<std::uint64_t> blockOffsets;
+	const std::size_t&& first = ring.count < ring.capacity ? 0 : ring.head;
+	for (std::size_t k = 0; k < ring.count; k++, offset += frameSize) {
+		const std::size_t&& index = (first + k) % ring.capacity;
+		ofs.write(reinterpret_cast<const char*>(ring.frames.data() + index * (1 + 3 * ring.N)), std::streamsize(frameSize));
+		blockOffsets.emplace_back(offset);
+	}
+	SnapShotFile::WriteFooter(ofs, blockOffsets, std::uint64_t(ring.count));
+	ofs.close();
+	if (!ofs) {
+		return std::string();
+	}
+	if (!state.empty()) {
+		std::ofstream ofsState(path.substr(0, path.size() - std::string(".snap").size()) + ".state", std::ios::binary | std::ios::trunc);
+		ofsState.write(state.data(), std::streamsize(state.size()));
+	}
+	return path;
+}
@@ -0,0 +1,55 @@
+/*
+	This is header file of the class of "FlightRecorderPackage" that keeps the last time steps of each simulation in a ring, and dumps them when the cars collide.
+	Each worker records x, v and a of all cars into its own "Ring" at every time step, so nothing is written to the disk unless the simulation fails.
+	A ring is a dense binary snapshot in the memory, and it is dumped as "FlightRecorder_N<N>_Seed<seed>.snap" (with "_RunN<run>") readable by "ctfm-snap".
+	The time of the frames is the simulated time since the attempt was started (or resumed) in this process, because the ring crosses the run-up and the measurements.
+	The metadata of the snapshot records where the simulation failed and the car numbers of the cars whose gap became negative.
+	The full state of the cars and the drivers at the failure is written next to it as ".state", in the same format as the checkpoints and the run-up cache.
+*/
+
+#ifndef FLIGHTRECORDERPACKAGE_H
+#define FLIGHTRECORDERPACKAGE_H
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "CarStruct.h"
+#include "FileSystemPackage.h"
+#include "SnapShotFilePackage.h"
+
+class FlightRecorderPackage {
+public:
+	//The last time steps of a simulation. Each frame is the time followed by x, v and a of all cars as a dense frame.
+	class Ring {
+	public:
+		Ring(const int& N, const int& Steps, const double& deltaT);	//constructor. The frames are allocated here, so recording never allocates.
+
+		void Record(const std::vector<CarStruct*>& cars, const std::vector<double>& accelerations);	//Overwrite the oldest frame with the state after the time step.
+		void Clear();	//Forget the frames when the simulation is started over.
+	private:
+		const std::size_t N;
+		const std::size_t capacity;
+		const double deltaT;
+		std::vector<double> frames;
+		std::size_t head;	//The frame that is written next.
+		std::size_t count;
+		long long steps;	//Time steps recorded since the attempt was started
+
+		friend class FlightRecorderPackage;
+	};
+
+	FlightRecorderPackage(const std::string& FolderPath, const int& IniFileNumber, const int& RunNumber, const int& Steps, const double& deltaT, const double& L);	//constructor
+	~FlightRecorderPackage();	//destructor
+
+	const int Steps;	//Time steps kept in a ring
+
+	std::string Dump(const Ring& ring, const int& N, const unsigned int& Seed, const std::string& metadata, const std::string& state) const;	//Write the frames of the ring and the state. Return the path of the snapshot, or empty if it cannot be written.
+private:
+	const std::string folderPath;
+	std::string FileNameBase;
+	const double deltaT;
+	const double L;
+};
+
+#endif // !FLIGHTRECORDERPACKAGE_H
@@ -19,8 +19,7 @@ void GRecognitionPackage::CalculateGSerise(const CarStruct* const car) const {
 
 	const DriverStruct* const driver = car->Driver;
 	const DriverElements::EigenValues* const driverEigen = driver->Eigen;
-	const DriverElements::EigenValuesElements::AccelerationPackage* const A = driverEigen->A;
-	const DriverElements::EigenValuesElements::AccelerationSeries* const Deceleration = A->Deceleration;
+	const DriverElements::SampledValues& sampled = driver->Sampled;
 	const Common::EigenValuesElements::GSerise* const G = driverEigen->G;
 	const double& v = carMoment->v;
 	const double& x = carMoment->x;
@@ -39,8 +38,8 @@ void GRecognitionPackage::CalculateGSerise(const CarStruct* const car) const {
 		frontX += L;
 	}
 	g->gap = frontX - front->Length - x;
-	g->closest = (std::max)(vT + v2 / Deceleration->Strong - vf2 / Deceleration->Acceptable + G->Closest, G->Closest);	//Calculated by Eq.(3-5).
-	g->cruise = (std::max)(vT + v2 / Deceleration->Normal - vf2 / A->FrontDeceleration->Normal, g->closest + G->Cruise);		//Calculated by Eq.(3-6).
+	g->closest = (std::max)(vT + v2 / sampled.DecelerationStrong - vf2 / driverEigen->DecelerationAcceptable + G->Closest, G->Closest);	//Calculated by Eq.(3-5).
+	g->cruise = (std::max)(vT + v2 / sampled.DecelerationNormal - vf2 / sampled.FrontDecelerationNormal, g->closest + G->Cruise);		//Calculated by Eq.(3-6).
 	g->influenced = (std::max)(g->cruise + v * GetTMargin(car), g->cruise + G->Influenced);	//Calculated by Eq.(3-7)
 	g->deltaGap->CopyCurrentToLast();	//Copy deltaGap of current to last  before updating current it.
 	g->deltaGap->current = g->gap - g->cruise;
@@ -0,0 +1,102 @@
+/*
+	This is cpp file of the class of "HashPackage" that calculates the 64 bit FNV-1a hash of values and files.
+*/
+
+#include "HashPackage.h"
+
+//constructor
+HashPackage::HashPackage() {
+	value = 14695981039346656037ULL;	//FNV offset basis
+}
+
+void HashPackage::Add(const void* data, const std::size_t& size) {
+	const unsigned char* bytes = static_cast<const unsigned char*>(data);
+	for (std::size_t i = 0; i < size; i++) {
+		value ^= bytes[i];
+		value *= 1099511628211ULL;	//FNV prime
+	}
+}
+
+void HashPackage::Add(const std::string& val) {
+	Add(std::uint64_t(val.size()));
+	Add(val.data(), val.size());
+}
+
+/*
+	Add all bytes of the file. If the file does not exist, it is added as an empty file.
+*/
+void HashPackage::AddFile(const std::string& FileName) {
+	std::ifstream ifs(FileName, std::ios::binary);
+	char buffer[4096];
+	std::uint64_t size = 0;
+	while (ifs) {
+		ifs.read(buffer, sizeof(buffer));
+		const std::size_t&& count = std::size_t(ifs.gcount());
+		Add(buffer, count);
+		size += count;
+	}
+	Add(size);
+}
+
+/*
+	Add the values of the ".ini" file as they are read, so that the comments, the spaces and the order do not change the hash.
+	The names are compared without the case as "ReadIniFilePackage" does. The sections in "IgnoredSections" are not added.
+*/
+void HashPackage::AddIniFile(const std::string& FileName, const std::vector<std::string>& IgnoredSections) {
+	const auto toUpper = [](std::string S) {
+		std::transform(S.begin(), S.end(), S.begin(), [](const char& c) { return char(std::toupper(c)); });
+		return S;
+	};
+	std::vector<std::string> ignored;
+	for (const std::string& section : IgnoredSections) {
+		ignored.emplace_back(toUpper(section));
+	}
+	std::map<std::pair<std::string, std::string>, std::string> values;
+	std::ifstream ifs(FileName);
+	std::string section;
+	std::string S;
+	while (std::getline(ifs, S)) {
+		if (!S.empty() && S.back() == '\r') {
+			S.pop_back();
+		}
+		if (S.empty()) {
+			continue;
+		}
+		if (S[0] == '[' && S[S.size() - 1] == ']') {
+			section = toUpper(S.substr(1, S.size() - 2));
+			continue;
+		}
+		const std::size_t&& ifind = S.find_first_of('=');
+		if (ifind == std::string::npos || std::find(ignored.begin(), ignored.end(), section) != ignored.end()) {
+			continue;
+		}
+		std::string value = S.substr(ifind + 1);
+		value.erase(std::remove(value.begin(), value.end(), ' '), value.end());
+		value = value.substr(0, value.find_first_of('#'));
+		if (!value.empty()) {
+			values[std::make_pair(section, toUpper(S.substr(0, ifind)))] = value;
+		}
+	}
+	Add(std::uint64_t(values.size()));
+	for (const std::pair<const std::pair<std::string, std::string>, std::string>& value : values) {
+		Add(value.first.first);
+		Add(value.first.second);
+		Add(value.second);
+	}
+}
+
+std::uint64_t HashPackage::Value() const {
+	return value;
+}
+
+/*
+	The hash value as 16 hexadecimal digits.
+*/
+std::string HashPackage::Hex() const {
+	const char* const digits = "0123456789abcdef";
+	std::string hex(16, '0');
+	for (int i = 0; i < 16; i++) {
+		hex[15 - i] = digits[(value >> (4 * i)) & 0xF];
+	}
+	return hex;
+}
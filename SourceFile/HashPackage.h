@@ -0,0 +1,36 @@
+/*
+	This is header file of the class of "HashPackage" that calculates the 64 bit FNV-1a hash of values and files.
+	This is used to create the keys of caches from the parameters of the simulation.
+*/
+
+#ifndef HASHPACKAGE_H
+#define HASHPACKAGE_H
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+class HashPackage {
+public:
+	HashPackage();	//constructor
+	void Add(const void* data, const std::size_t& size);
+	void Add(const std::string& val);
+	void AddFile(const std::string& FileName);	//Add all bytes of the file. If the file does not exist, it is added as an empty file.
+	void AddIniFile(const std::string& FileName, const std::vector<std::string>& IgnoredSections = std::vector<std::string>());	//Add the values of the ".ini" file as they are read, so that the comments, the spaces and the order do not change the hash.
+
+	template<typename _T>
+	void Add(const _T& val) {
+		Add(&val, sizeof(_T));
+	}
+
+	std::uint64_t Value() const;
+	std::string Hex() const;	//The hash value as 16 hexadecimal digits.
+private:
+	std::uint64_t value;
+};
+
+#endif // !HASHPACKAGE_H
@@ -1,20 +1,17 @@
 /*
-	This is header file of the class of "InitializerClass" that reads car and driver-specific information from the ".ini" file and determines the initial position of the car.
+	This is header file of the class of "InitializerClass" that initializes the cars and the drivers from the profiles read from the ".ini" file and determines the initial position of the car.
 	This inherits from "ModelBaseClass".
 */
 
 #include "InitializerClass.h"
 
 //constructor
-InitializerClass::InitializerClass(const std::string& IniFileFolderPath, const int& IniFileNumber, const ModelBaseClass* myBase) : ModelBaseClass(myBase) {
+InitializerClass::InitializerClass(const ProfileParametersClass& ProfileParameters, const ModelBaseClass* myBase) : ModelBaseClass(myBase), ProfileParameters(ProfileParameters) {
 	InitializeProperties(this);
-	ReadIniFile = new ReadIniFilePackage(IniFileFolderPath + R"(/Ini)" + std::to_string(IniFileNumber) + ".ini");
 }
 
 //destructor
-InitializerClass::~InitializerClass() {
-	SafeDelete(ReadIniFile);	//delete ReadIniFilePackage
-}
+InitializerClass::~InitializerClass() { }
 
 /*
 	Initialize all parameters of car and driver, in addition, initializes the set positions of all cars.
@@ -30,113 +27,39 @@ bool InitializerClass::Initialize() {
 }
 
 /*
-	Initialize all parameters of car and driver reading ".ini" file.
+	Initialize all parameters of car and driver from the profiles read from the ".ini" file.
+	The cars and the drivers refer to the shared eigenvalues, and only the values that vary between the drivers draw random numbers, in the same order as they were read from the ".ini" file.
 */
 void InitializerClass::InitializeCarsAndDrivers() {
-	double pVal;
-	double mVal;
-	std::string sModeType;
+	const CarElements::EigenValues* const carEigen = ProfileParameters.CarEigen;
+	const DriverElements::EigenValues* const driverEigen = ProfileParameters.DriverEigen;
+	const ProfileParametersClass::DriverProfile& driverProfile = ProfileParameters.Driver;
+	const DriverElements::EigenValuesElements::VSerise* const V = driverEigen->V;
 	allDclosest = 0;
 	allCarLength = 0;
 	for (std::size_t i = 0; i < std::size_t(N); i++) {
-		(*cars)[i] = new CarStruct();
+		(*cars)[i] = new CarStruct(carEigen, driverEigen);
 		//Car
 		CarStruct* const car = (*cars)[i];
 		car->ID = i;
-		CarElements::EigenValues* const carEigen = car->Eigen;
 		CarElements::MomentValues* const carMoment = car->Moment;
 
-		carEigen->Vmax = Calculate_Km_h_To_m_s(ReadIniFile->ReadIni("Car Informations", "Vmax"));
-		carEigen->Amax->Plus = Calculate_Km_h_To_m_s(ReadIniFile->ReadIni("Car Informations", "A^+_max_V")) / ReadIniFile->ReadIni("Car Informations", "A^+_max_s");
-		carEigen->Amax->Minus = std::pow(Calculate_Km_h_To_m_s(ReadIniFile->ReadIni("Car Informations", "A^-_max_V")), 2) / 2 / ReadIniFile->ReadIni("Car Informations", "A^-_max_D");
-		carEigen->AResistance = Calculate_Km_h_To_m_s(ReadIniFile->ReadIni("Car Informations", "A^-_resistence"));
-		carEigen->Length = ReadIniFile->ReadIni("Car Informations", "Length");
-		ReadIniFile->ReadIni("Car Informations", "Driver", sModeType, ReadIniFilePackage::TransformModeType::Lower);
-		if (sModeType == "auto") {
-			carEigen->DriverMode = DriverModeType::Auto;
-		}
-		else {
-			carEigen->DriverMode = DriverModeType::Human;
-		}
-
 		carMoment->a = 0;
 		carMoment->v = 0;
 
 		//Driver
 		DriverStruct* const driver = car->Driver;
-		DriverElements::EigenValues* const driverEigen = driver->Eigen;
+		DriverElements::SampledValues& sampled = driver->Sampled;
 		DriverElements::MomentValues* const driverMoment = driver->Moment;
-		DriverElements::EigenValuesElements::AccelerationPackage* const driverEigenA = driverEigen->A;
-		DriverElements::EigenValuesElements::AccelerationSeries* const Acceleration = driverEigenA->Acceleration;
-		DriverElements::EigenValuesElements::AccelerationSeries* const Deceleration = driverEigenA->Deceleration;
-		DriverElements::EigenValuesElements::AccelerationSeries* const FrontDeceleration = driverEigenA->FrontDeceleration;
-		DriverElements::EigenValuesElements::VSerise* const V = driverEigen->V;
-		DriverElements::EigenValuesElements::PedalChangingTimeInformations* const PedalChange = driverEigen->PedalChange;
-		DriverElements::EigenValuesElements::TMargin* const TMargin = driverEigen->TMargin;
-		Common::EigenValuesElements::GSerise* const G = driverEigen->G;
-
-		Deceleration->Acceptable = ReadIniFile->ReadIni("Driver Informations::A", "A^-_acceptable");
-
-		ReadIniFile->ReadIni("Driver Informations::A", "A^+_acceptable_mode", sModeType, ReadIniFilePackage::TransformModeType::Lower);
-		if (sModeType == "equal") {
-			Acceleration->Acceptable = Calculate_Km_h_To_m_s(ReadIniFile->ReadIni("Driver Informations::A", "A^+_acceptable_V")) / ReadIniFile->ReadIni("Driver Informations::A", "A^+_acceptable_s");
-		}
-		else {
-			pVal = ReadIniFile->ReadIni("Driver Informations::A", "A^+_acceptable_s^+");
-			mVal = ReadIniFile->ReadIni("Driver Informations::A", "A^+_acceptable_s^-");
-			Acceleration->Acceptable = Calculate_Km_h_To_m_s(ReadIniFile->ReadIni("Driver Informations::A", "A^+_acceptable_V")) / (*random)(mVal, pVal);
-		}
-
-		ReadIniFile->ReadIni("Driver Informations::A", "A^-_strong_mode", sModeType, ReadIniFilePackage::TransformModeType::Lower);
-		if (sModeType == "equal") {
-			Deceleration->Strong = ReadIniFile->ReadIni("Driver Informations::A", "A^-_strong");
-		}
-		else {
-			pVal = ReadIniFile->ReadIni("Driver Informations::A", "A^-_strong^+");
-			mVal = ReadIniFile->ReadIni("Driver Informations::A", "A^-_strong^-");
-			Deceleration->Strong = (*random)(mVal, pVal);
-		}
 
-		ReadIniFile->ReadIni("Driver Informations::A", "A^-_normal_mode", sModeType, ReadIniFilePackage::TransformModeType::Lower);
-		if (sModeType == "equal") {
-			Deceleration->Normal = ReadIniFile->ReadIni("Driver Informations::A", "A^-_normal");
-		}
-		else {
-			pVal = ReadIniFile->ReadIni("Driver Informations::A", "A^-_normal^+");
-			mVal = ReadIniFile->ReadIni("Driver Informations::A", "A^-_normal^-");
-			Deceleration->Normal = (*random)(mVal, pVal);
-		}
-
-		ReadIniFile->ReadIni("Driver Informations::A", "A^-_Fnormal_mode", sModeType, ReadIniFilePackage::TransformModeType::Lower);
-		if (sModeType == "equal") {
-			FrontDeceleration->Normal = ReadIniFile->ReadIni("Driver Informations::A", "A^-_Fnormal");
-		}
-		else {
-			pVal = ReadIniFile->ReadIni("Driver Informations::A", "A^-_Fnormal^+");
-			mVal = ReadIniFile->ReadIni("Driver Informations::A", "A^-_Fnormal^-");
-			FrontDeceleration->Normal = (*random)(mVal, pVal);
-		}
+		sampled.AccelerationAcceptable = driverProfile.AccelerationAcceptableV / driverProfile.AccelerationAcceptableS.Sample(*random);
+		sampled.DecelerationStrong = driverProfile.DecelerationStrong.Sample(*random);
+		sampled.DecelerationNormal = driverProfile.DecelerationNormal.Sample(*random);
+		sampled.FrontDecelerationNormal = driverProfile.FrontDecelerationNormal.Sample(*random);
 		driverMoment->a = 0;
 		driverMoment->R->velocity = 1 - (*random)(1.0);
 		driverMoment->R->gap = 1 - (*random)(1.0);
-
-		ReadIniFile->ReadIni("Driver Informations::Fg", "Fg_mode", sModeType, ReadIniFilePackage::TransformModeType::Lower);
-		if (sModeType == "equal") {
-			driverMoment->g->SetBaseNg(ReadIniFile->ReadIni("Driver Informations::Fg", "randomValue"));
-		}
-		else {
-			pVal = ReadIniFile->ReadIni("Driver Informations::Fg", "randomValue^+");
-			mVal = ReadIniFile->ReadIni("Driver Informations::Fg", "randomValue^-");
-			driverMoment->g->SetBaseNg((*random)(mVal, pVal));
-		}
-
-		Common::EigenValuesElements::PlusMinus* const DeltaAtCruise = V->DeltaAtCruise;
-		Common::EigenValuesElements::PlusMinus* const DeltaAt0 = V->DeltaAt0;
-		V->Cruise = Calculate_Km_h_To_m_s(ReadIniFile->ReadIni("Driver Informations::V", "V_cruise"));
-		DeltaAtCruise->Plus = Calculate_Km_h_To_m_s(ReadIniFile->ReadIni("Driver Informations::V", "deltaV^+_cruise"));
-		DeltaAtCruise->Minus = Calculate_Km_h_To_m_s(ReadIniFile->ReadIni("Driver Informations::V", "deltaV^-_cruise"));
-		DeltaAt0->Plus = Calculate_Km_h_To_m_s(ReadIniFile->ReadIni("Driver Informations::V", "deltaV^+_0"));
-		DeltaAt0->Minus = Calculate_Km_h_To_m_s(ReadIniFile->ReadIni("Driver Informations::V", "deltaV^-_0"));
+		driverMoment->g->SetBaseNg(driverProfile.Fg.Sample(*random));
 
 		//Set Vcruise as the target velocity.
 		DriverElements::MomentValuesElements::VSerise* const v = driverMoment->v;
@@ -145,35 +68,9 @@ void InitializerClass::InitializeCarsAndDrivers() {
 		v->target = V->Cruise;
 		deltaV->current = -V->Cruise;
 		deltaV->last = -V->Cruise;
-		delta->plus = DeltaAtCruise->Plus;
-		delta->minus = DeltaAtCruise->Minus;
-
-		DriverElements::EigenValuesElements::PedalChanging* const PedalChangeV = PedalChange->V;
-		DriverElements::EigenValuesElements::PedalChanging* const PedalChangeT = PedalChange->T;
-		Common::EigenValuesElements::UpperLower* const VAccelToBrake = PedalChangeV->AccelToBrake;
-		Common::EigenValuesElements::UpperLower* const VBrakeToAccel = PedalChangeV->BrakeToAccel;
-		Common::EigenValuesElements::UpperLower* const TAccelToBrake = PedalChangeT->AccelToBrake;
-		Common::EigenValuesElements::UpperLower* const TBrakeToAccel = PedalChangeT->BrakeToAccel;
-		VAccelToBrake->Upper = Calculate_Km_h_To_m_s(ReadIniFile->ReadIni("Driver Informations::Pedal Change", "V^+_ab"));
-		VAccelToBrake->Lower = Calculate_Km_h_To_m_s(ReadIniFile->ReadIni("Driver Informations::Pedal Change", "V^-_ab"));
-		TAccelToBrake->Upper = ReadIniFile->ReadIni("Driver Informations::Pedal Change", "T^+_ab");
-		TAccelToBrake->Lower = ReadIniFile->ReadIni("Driver Informations::Pedal Change", "T^-_ab");
-		VBrakeToAccel->Upper = Calculate_Km_h_To_m_s(ReadIniFile->ReadIni("Driver Informations::Pedal Change", "V^+_ba"));
-		VBrakeToAccel->Lower = Calculate_Km_h_To_m_s(ReadIniFile->ReadIni("Driver Informations::Pedal Change", "V^-_ba"));
-		TBrakeToAccel->Upper = ReadIniFile->ReadIni("Driver Informations::Pedal Change", "T^+_ba");
-		TBrakeToAccel->Lower = ReadIniFile->ReadIni("Driver Informations::Pedal Change", "T^-_ba");
-
-		Common::EigenValuesElements::UpperLower* const TMarginV = TMargin->V;
-		Common::EigenValuesElements::UpperLower* const TMarginT = TMargin->T;
-		TMarginV->Upper = Calculate_Km_h_To_m_s(ReadIniFile->ReadIni("Driver Informations::Margin", "V^+_margin"));
-		TMarginV->Lower = Calculate_Km_h_To_m_s(ReadIniFile->ReadIni("Driver Informations::Margin", "V^-_margin"));
-		TMarginT->Upper = ReadIniFile->ReadIni("Driver Informations::Margin", "T^+_margin");
-		TMarginT->Lower = ReadIniFile->ReadIni("Driver Informations::Margin", "T^-_margin");
+		delta->plus = V->DeltaAtCruise->Plus;
+		delta->minus = V->DeltaAtCruise->Minus;
 
-		G->Closest = ReadIniFile->ReadIni("Driver Informations::G", "G_closest");
-		G->Cruise = ReadIniFile->ReadIni("Driver Informations::G", "G_cruise");
-		G->Influenced = ReadIniFile->ReadIni("Driver Informations::G", "G_influenced");
-		
 		allDclosest += driverEigen->G->Closest;
 		allCarLength += carEigen->Length;
 	}
@@ -1,5 +1,5 @@
 /*
-	This is header file of the class of "InitializerClass" that reads car and driver-specific information from the ".ini" file and determines the initial position of the car.
+	This is header file of the class of "InitializerClass" that initializes the cars and the drivers from the profiles read from the ".ini" file and determines the initial position of the car.
 	This inherits from "ModelBaseClass".
 */
 
@@ -9,21 +9,21 @@
 #include "VectorSort.h"
 #include "Common.h"
 #include "ModelBaseClass.h"
-#include "ReadIniFilePackage.h"
+#include "ProfileParametersClass.h"
 #include "ReadOnlyPropertyClass.h"
 
 class InitializerClass : public ModelBaseClass {
 public:
-	InitializerClass(const std::string& IniFileFolderPath, const int& IniFileNumber, const ModelBaseClass* myBase);	//constructor
+	InitializerClass(const ProfileParametersClass& ProfileParameters, const ModelBaseClass* myBase);	//constructor
 	~InitializerClass();	//destructor
 
 	bool Initialize();	//Initialize all parameters of car and driver, in addition, initializes the set positions of all cars.
 private:
-	ReadIniFilePackage* ReadIniFile;
+	const ProfileParametersClass& ProfileParameters;
 	double allCarLength;
 	double allDclosest;
 
-	void InitializeCarsAndDrivers();	//Initialize all parameters of car and driver reading ".ini" file.
+	void InitializeCarsAndDrivers();	//Initialize all parameters of car and driver from the profiles read from the ".ini" file.
 	bool InitializePosition() const;			//Initializes the set positions of all cars.
 	bool EqualizeAllGap() const;	//Set up all cars with an equal distance between them.
 	void ChangePositionFromUniformToRandom() const;	//Change the position from uniform to random.
@@ -0,0 +1,28 @@
+/*
+	This is cpp file of the functions of "InterruptHandler" that catch SIGINT and SIGTERM.
+*/
+
+#include "InterruptHandlerPackage.h"
+
+namespace {
+	volatile std::sig_atomic_t requested = 0;
+
+	extern "C" void OnSignal(int) {
+		requested = 1;
+	}
+}
+
+/*
+	Start catching SIGINT and SIGTERM.
+*/
+void InterruptHandler::Install() {
+	std::signal(SIGINT, OnSignal);
+	std::signal(SIGTERM, OnSignal);
+}
+
+/*
+	Whether SIGINT or SIGTERM has been received.
+*/
+bool InterruptHandler::Requested() {
+	return requested != 0;
+}
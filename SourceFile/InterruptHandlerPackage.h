@@ -0,0 +1,15 @@
+/*
+	This is header file of the functions of "InterruptHandler" that catch SIGINT and SIGTERM.
+	The handler only raises a flag, and the running simulations check it at each time step so that they can save their checkpoints and stop.
+*/
+
+#ifndef INTERRUPTHANDLERPACKAGE_H
+#define INTERRUPTHANDLERPACKAGE_H
+#include <csignal>
+
+namespace InterruptHandler {
+	void Install();	//Start catching SIGINT and SIGTERM.
+	bool Requested();	//Whether SIGINT or SIGTERM has been received.
+}
+
+#endif // !INTERRUPTHANDLERPACKAGE_H
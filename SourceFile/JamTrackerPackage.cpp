@@ -0,0 +1,240 @@
+/*
+	This is cpp file of the class of "JamTrackerPackage" that finds the congested clusters of the cars during each measurement, and tracks them over the time steps.
+*/
+
+#include "JamTrackerPackage.h"
+
+//constructor
+JamTrackerPackage::Clusters::Clusters(const JamTrackerPackage& Tracker, const int& N) : tracker(Tracker) {
+	order.assign(std::size_t(N), 0);
+	label.assign(std::size_t(N), -1);
+	nextLabel.assign(std::size_t(N), -1);
+	steps = 0;
+	clusterNumber = 0;
+}
+
+/*
+	Start a new measurement.
+*/
+void JamTrackerPackage::Clusters::Clear() {
+	std::fill(label.begin(), label.end(), -1);
+	tracks.clear();
+	steps = 0;
+	clusterNumber = 0;
+	events.str("");
+	events.clear();
+}
+
+/*
+	Advance to the next time step, and find the clusters at the interval.
+*/
+void JamTrackerPackage::Clusters::EndStep(const std::vector<CarStruct*>& cars) {
+	steps++;
+	if (steps % tracker.interval == 0) {
+		Scan(cars);
+	}
+}
+
+/*
+	Record the clusters alive at the end of the measurement.
+*/
+void JamTrackerPackage::Clusters::EndMeasurement() {
+	const double&& time = double(steps) * tracker.deltaT;
+	for (const Track& track : tracks) {
+		Event(time, "End", track, 0, true);
+	}
+}
+
+/*
+	The ring is walked from the car ahead of a car that is not congested, so that no run is split at the end of the walk.
+	If all cars are congested, they are a single cluster whose downstream front is the car with the largest gap.
+*/
+void JamTrackerPackage::Clusters::Scan(const std::vector<CarStruct*>& cars) {
+	const double&& time = double(steps) * tracker.deltaT;
+	const std::size_t&& n = cars.size();
+	std::size_t last = n;
+	for (std::size_t i = 0; i < n; i++) {
+		if (!IsCongested(cars[i])) {
+			last = i;
+			break;
+		}
+	}
+	if (last == n) {
+		last = 0;
+		for (std::size_t i = 1; i < n; i++) {
+			if (cars[i]->Moment->g->gap > cars[last]->Moment->g->gap) {
+				last = i;
+			}
+		}
+	}
+	std::size_t id = last;
+	for (std::size_t k = 0; k < n; k++) {
+		id = cars[id]->Moment->arround->front->ID;
+		order[k] = id;
+	}
+
+	//Split the ring into the runs, and vote for the clusters of the last scan by their cars.
+	runs.clear();
+	for (std::size_t k = 0; k < n;) {
+		if (!IsCongested(cars[order[k]])) {
+			k++;
+			continue;
+		}
+		std::size_t end = k + 1;
+		while (end < n && IsCongested(cars[order[end]])) {
+			end++;
+		}
+		if (int(end - k) >= tracker.minCars) {
+			Run run;
+			run.Begin = k;
+			run.Cars = int(end - k);
+			run.Track = -1;
+			run.Parent = 0;
+			runs.emplace_back(run);
+		}
+		k = end;
+	}
+	owner.assign(tracks.size(), -1);
+	ownerVotes.assign(tracks.size(), 0);
+	candidate.assign(runs.size(), -1);
+	for (std::size_t r = 0; r < runs.size(); r++) {
+		votes.clear();
+		for (std::size_t k = runs[r].Begin; k < runs[r].Begin + std::size_t(runs[r].Cars); k++) {
+			const int& t = label[order[k]];
+			if (t < 0) {
+				continue;
+			}
+			std::size_t j = 0;
+			while (j < votes.size() && votes[j].first != t) {
+				j++;
+			}
+			if (j == votes.size()) {
+				votes.emplace_back(t, 0);
+			}
+			votes[j].second++;
+		}
+		int best = -1;
+		int bestVotes = 0;
+		for (const std::pair<int, int>& vote : votes) {
+			if (vote.second > bestVotes || (vote.second == bestVotes && vote.first < best)) {
+				best = vote.first;
+				bestVotes = vote.second;
+			}
+		}
+		candidate[r] = best;
+		if (best >= 0 && bestVotes > ownerVotes[best]) {
+			owner[best] = int(r);
+			ownerVotes[best] = bestVotes;
+		}
+	}
+
+	//The clusters of this scan
+	nextTracks.clear();
+	std::fill(nextLabel.begin(), nextLabel.end(), -1);
+	for (std::size_t r = 0; r < runs.size(); r++) {
+		Run& run = runs[r];
+		const double& upstreamX = cars[order[run.Begin]]->Moment->x;
+		const double& downstreamX = cars[order[run.Begin + std::size_t(run.Cars) - 1]]->Moment->x;
+		Track track;
+		if (candidate[r] >= 0 && owner[candidate[r]] == int(r)) {
+			track = tracks[candidate[r]];
+			track.UpstreamDisplacement += tracker.Displacement(track.UpstreamX, upstreamX);
+			track.DownstreamDisplacement += tracker.Displacement(track.DownstreamX, downstreamX);
+			run.Track = candidate[r];
+		}
+		else {
+			track.Number = ++clusterNumber;
+			track.BirthTime = time;
+			track.UpstreamDisplacement = 0;
+			track.DownstreamDisplacement = 0;
+			run.Parent = candidate[r] >= 0 ? tracks[candidate[r]].Number : 0;
+		}
+		track.Cars = run.Cars;
+		track.UpstreamX = upstreamX;
+		track.DownstreamX = downstreamX;
+		track.LastTime = time;
+		for (std::size_t k = run.Begin; k < run.Begin + std::size_t(run.Cars); k++) {
+			nextLabel[order[k]] = int(nextTracks.size());
+		}
+		nextTracks.emplace_back(track);
+	}
+
+	//The clusters that are not kept die, into the cluster that has their cars if they are merged.
+	for (std::size_t t = 0; t < tracks.size(); t++) {
+		if (owner[t] >= 0) {
+			continue;
+		}
+		int other = 0;
+		for (std::size_t i = 0; i < n; i++) {
+			if (label[i] == int(t) && nextLabel[i] >= 0) {
+				other = nextTracks[nextLabel[i]].Number;
+				break;
+			}
+		}
+		Event(time, "Death", tracks[t], other, true);
+	}
+	for (std::size_t r = 0; r < runs.size(); r++) {
+		if (runs[r].Track < 0) {
+			Event(time, "Birth", nextTracks[r], runs[r].Parent, false);
+		}
+	}
+	tracks.swap(nextTracks);
+	label.swap(nextLabel);
+}
+
+/*
+	"Time,Event,Cluster,Other,Cars,UpstreamX,DownstreamX,Lifetime,UpstreamSpeed,DownstreamSpeed"
+	The lifetime and the propagation speeds (km/h) are written with "summary", until the last scan that found the cluster.
+*/
+void JamTrackerPackage::Clusters::Event(const double& time, const char* const name, const Track& track, const int& other, const bool& summary) {
+	const int& digits = tracker.digits;
+	events << DoubleFormat::Text(time, digits) << "," << name << "," << track.Number << "," << other << "," << track.Cars << ","
+		<< DoubleFormat::Text(track.UpstreamX, digits) << "," << DoubleFormat::Text(track.DownstreamX, digits) << ",";
+	const double&& lifetime = track.LastTime - track.BirthTime;
+	if (summary) {
+		events << DoubleFormat::Text(lifetime, digits);
+	}
+	events << ",";
+	if (summary && lifetime > 0) {
+		events << DoubleFormat::Text(Calculate_m_s_To_Km_h(track.UpstreamDisplacement / lifetime), digits) << "," << DoubleFormat::Text(Calculate_m_s_To_Km_h(track.DownstreamDisplacement / lifetime), digits);
+	}
+	else {
+		events << ",";
+	}
+	events << "\n";
+}
+
+bool JamTrackerPackage::Clusters::IsCongested(const CarStruct* const car) const {
+	return car->Moment->v < tracker.speedThreshold && car->Moment->g->gap < tracker.gapThreshold;
+}
+
+//constructor
+JamTrackerPackage::JamTrackerPackage(const std::string& FolderPath, const int& IniFileNumber, const int& RunNumber, const int& Interval, const double& SpeedThreshold, const double& GapThreshold, const int& MinCars, const double& L, const double& deltaT, const int& Digits)
+	: interval(Interval), speedThreshold(SpeedThreshold), gapThreshold(GapThreshold), minCars(MinCars), L(L), deltaT(deltaT), digits(Digits), Files(FolderPath, IniFileNumber, RunNumber, "Jam") { }
+
+//destructor
+JamTrackerPackage::~JamTrackerPackage() { }
+
+/*
+	Write the events of the measurement. Return false if the file cannot be written.
+*/
+bool JamTrackerPackage::Write(const Clusters& clusters, const int& N, const int& MeasureNumber) const {
+	return Files.Write(Files.Path(N, MeasureNumber, ".csv"), false, [&](std::ostream& ofs) {
+		ofs << "Time,Event,Cluster,Other,Cars,UpstreamX,DownstreamX,Lifetime,UpstreamSpeed,DownstreamSpeed" << "\n";
+		ofs << clusters.events.str();
+	});
+}
+
+/*
+	m from "x0" to "x1" on the ring, in [-L/2, L/2)
+*/
+double JamTrackerPackage::Displacement(const double& x0, const double& x1) const {
+	double d = x1 - x0;
+	if (d >= L / 2) {
+		d -= L;
+	}
+	else if (d < -L / 2) {
+		d += L;
+	}
+	return d;
+}
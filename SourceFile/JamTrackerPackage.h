@@ -0,0 +1,97 @@
+/*
+	This is header file of the class of "JamTrackerPackage" that finds the congested clusters of the cars during each measurement, and tracks them over the time steps.
+	A car is congested when its velocity is below "Speed Threshold" and its gap to the front car is below "Gap Threshold", where the gap is that recognized in the time step.
+	Every "Interval" time steps the ring is split into the runs of the congested cars, and the runs of "Min Cars" or more cars are the clusters.
+	A cluster is the same as the cluster of the last scan that had the most of its cars. When a cluster is split, the largest part keeps it and the others are born from it,
+	and when clusters are merged, the others die into the one that is kept.
+	The upstream front is the rearmost car of a cluster and the downstream front is the foremost car. Their propagation speeds are the displacements unwrapped on the ring divided by the lifetime.
+	Each simulation tracks the clusters into its own "Clusters", and the events of each measurement are written as "Jam_N<N>_MeasureN<measure>.csv" (with "_RunN<run>"):
+	"Birth", "Death", and "End" for the clusters alive at the end of the measurement. "Other" is the cluster that it was split from or merged into.
+*/
+
+#ifndef JAMTRACKERPACKAGE_H
+#define JAMTRACKERPACKAGE_H
+#include <algorithm>
+#include <cmath>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include "CarStruct.h"
+#include "Common.h"
+#include "DoubleFormatPackage.h"
+#include "MeasurementFilePackage.h"
+
+class JamTrackerPackage {
+public:
+	//The clusters of a measurement of a simulation
+	class Clusters {
+	public:
+		Clusters(const JamTrackerPackage& Tracker, const int& N);	//constructor
+
+		void Clear();	//Start a new measurement.
+		void EndStep(const std::vector<CarStruct*>& cars);	//Advance to the next time step, and find the clusters at the interval.
+		void EndMeasurement();	//Record the clusters alive at the end of the measurement.
+	private:
+		//A cluster being tracked
+		struct Track {
+			int Number;	//1-based in the measurement
+			double BirthTime;	//s
+			int Cars;
+			double UpstreamX;	//m
+			double DownstreamX;	//m
+			double UpstreamDisplacement;	//m, unwrapped since the birth
+			double DownstreamDisplacement;	//m
+			double LastTime;	//s, the last scan that found it
+		};
+
+		//A run of the congested cars in the current scan
+		struct Run {
+			std::size_t Begin;	//The index of the upstream car in "order"
+			int Cars;
+			int Track;	//The index in "tracks", -1 if it is born.
+			int Parent;	//The number of the cluster that it is split from, 0 if none.
+		};
+
+		const JamTrackerPackage& tracker;
+		std::vector<std::size_t> order;	//The cars from the upstream to the downstream
+		std::vector<int> label;	//The index in "tracks" of each car in the last scan, -1 if it was not in a cluster.
+		std::vector<int> nextLabel;
+		std::vector<Run> runs;
+		std::vector<Track> tracks;
+		std::vector<Track> nextTracks;
+		std::vector<std::pair<int, int>> votes;	//The track and the cars of a run in it
+		std::vector<int> candidate;	//The track that each run has the most cars of, -1 if none.
+		std::vector<int> owner;	//The run that keeps each track, -1 if it dies.
+		std::vector<int> ownerVotes;
+		long long steps;	//Time steps of the current measurement
+		int clusterNumber;	//The last number given to a cluster
+		std::stringstream events;
+
+		void Scan(const std::vector<CarStruct*>& cars);
+		void Event(const double& time, const char* const name, const Track& track, const int& other, const bool& summary);
+		bool IsCongested(const CarStruct* const car) const;
+
+		friend class JamTrackerPackage;
+	};
+
+	JamTrackerPackage(const std::string& FolderPath, const int& IniFileNumber, const int& RunNumber, const int& Interval, const double& SpeedThreshold, const double& GapThreshold, const int& MinCars, const double& L, const double& deltaT, const int& Digits);	//constructor
+	~JamTrackerPackage();	//destructor
+
+	bool Write(const Clusters& clusters, const int& N, const int& MeasureNumber) const;	//Write the events of the measurement. Return false if the file cannot be written.
+private:
+	const int interval;	//Time steps
+	const double speedThreshold;	//m/s
+	const double gapThreshold;	//m
+	const int minCars;
+	const double L;
+	const double deltaT;
+	const int digits;
+	const MeasurementFilePackage Files;
+
+	double Displacement(const double& x0, const double& x1) const;	//m from "x0" to "x1" on the ring, in [-L/2, L/2)
+};
+
+#endif // !JAMTRACKERPACKAGE_H
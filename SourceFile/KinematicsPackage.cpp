@@ -0,0 +1,43 @@
+/*
+	This is cpp file of the functions of "Kinematics" that move a car by one time step with a constant acceleration.
+*/
+
+#include "KinematicsPackage.h"
+
+/*
+	Calculate the position and the velocity after deltaT on the ring road of length L. If the car stops during the step, return true.
+*/
+bool Kinematics::Advance(const double& x, const double& v, const double& a, const double& deltaT, const double& L, double& nextX, double& nextV) {
+	bool stopped = false;
+	nextV = v + a * deltaT;
+	if (nextV > 0) {
+		nextX = x + v * deltaT + 0.5 * a * std::pow(deltaT, 2);
+	}
+	else {
+		//Due to the model, go backwards is not allowed.
+		if (a < 0) {
+			nextX = x - 0.5 * std::pow(v, 2) / a;
+		}
+		else {
+			nextX = x;
+		}
+		nextV = 0;
+		stopped = true;
+	}
+	if (nextX >= L) {
+		nextX -= L;
+	}
+	return stopped;
+}
+
+/*
+	The time to travel "distance" from the start of the time step with the velocity and the acceleration of the step. This is used by the detectors.
+*/
+double Kinematics::ElapsedTime(const double& v, const double& a, const double& distance) {
+	if (a == 0) {
+		return distance / v;
+	}
+	else {
+		return (-v + std::sqrt(std::pow(v, 2) + 2 * a * distance)) / a;
+	}
+}
@@ -0,0 +1,17 @@
+/*
+	This is header file of the functions of "Kinematics" that move a car by one time step with a constant acceleration.
+	The model and the decoder of the event-log snapshots use the same function, so that the decoded positions are exactly the same as the simulated ones.
+*/
+
+#ifndef KINEMATICSPACKAGE_H
+#define KINEMATICSPACKAGE_H
+#include <cmath>
+
+namespace Kinematics {
+	//Calculate the position and the velocity after deltaT on the ring road of length L. If the car stops during the step, return true.
+	bool Advance(const double& x, const double& v, const double& a, const double& deltaT, const double& L, double& nextX, double& nextV);
+	//The time to travel "distance" from the start of the time step with the velocity and the acceleration of the step. This is used by the detectors.
+	double ElapsedTime(const double& v, const double& a, const double& distance);
+}
+
+#endif // !KINEMATICSPACKAGE_H
@@ -0,0 +1,314 @@
+/*
+	This is cpp file of the class of "LiveStatePackage" that publishes the states of the simulations in progress to a POSIX shared memory, so that the other processes can watch them.
+*/
+
+#include "LiveStatePackage.h"
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <new>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // !_WIN32
+
+namespace {
+	const char LiveStateMagic[8] = { 'C', 'T', 'F', 'M', 'L', 'I', 'V', '1' };
+	const std::uint64_t Alignment = 64;	//The slots are on the different cache lines.
+
+	std::uint64_t Align(const std::uint64_t& size) {
+		return (size + Alignment - 1) / Alignment * Alignment;
+	}
+}
+
+/*
+	The shared memory is created. If it is left by a crashed simulation, it is replaced.
+	If it is used by a running simulation of the same ini file and run, nothing is published.
+*/
+LiveStatePackage::LiveStatePackage(const std::string& Name, const int& Interval, const int& Slots, const int& MaxCars, const int& IniFileNumber, const int& RunNumber, const double& L, const double& deltaT)
+	: Interval(Interval), Name(Name), created(true) {
+	data = nullptr;
+	size = 0;
+	runningOwner = 0;
+#ifndef _WIN32
+	runningOwner = FindRunningOwner(Name);
+	if (runningOwner != 0) {
+		return;
+	}
+	const std::uint64_t&& slotSize = Align(sizeof(SlotHeader) + std::uint64_t(MaxCars) * (3 * sizeof(double) + sizeof(std::uint8_t)));
+	const std::uint64_t&& totalSize = Align(sizeof(Header)) + slotSize * std::uint64_t(Slots);
+	shm_unlink(Name.c_str());
+	const int&& fd = shm_open(Name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+	if (fd < 0) {
+		return;
+	}
+	if (ftruncate(fd, off_t(totalSize)) != 0) {
+		close(fd);
+		shm_unlink(Name.c_str());
+		return;
+	}
+	size = totalSize;
+	Map(fd, true);
+	if (data == nullptr) {
+		shm_unlink(Name.c_str());
+		return;
+	}
+	//The memory is filled with 0 by "ftruncate", so the slots are free and not being written.
+	for (int i = 0; i < Slots; i++) {
+		new(data + Align(sizeof(Header)) + slotSize * std::uint64_t(i)) SlotHeader();
+	}
+	Header* const header = reinterpret_cast<Header*>(data);
+	header->Slots = std::uint32_t(Slots);
+	header->MaxCars = std::uint32_t(MaxCars);
+	header->IniFileNumber = IniFileNumber;
+	header->RunNumber = RunNumber;
+	header->L = L;
+	header->deltaT = deltaT;
+	header->SlotSize = slotSize;
+	header->ProcessID = std::int64_t(getpid());
+	std::atomic_thread_fence(std::memory_order_release);
+	std::memcpy(header->Magic, LiveStateMagic, sizeof(LiveStateMagic));	//The readers check this last.
+#else
+	(void)Slots;
+	(void)MaxCars;
+	(void)IniFileNumber;
+	(void)RunNumber;
+	(void)L;
+	(void)deltaT;
+#endif // !_WIN32
+}
+
+/*
+	The shared memory is opened to read.
+*/
+LiveStatePackage::LiveStatePackage(const std::string& Name)
+	: Interval(0), Name(Name), created(false) {
+	data = nullptr;
+	size = 0;
+	runningOwner = 0;
+#ifndef _WIN32
+	const int&& fd = shm_open(Name.c_str(), O_RDONLY, 0);
+	if (fd < 0) {
+		return;
+	}
+	struct stat st;
+	if (fstat(fd, &st) != 0 || std::uint64_t(st.st_size) < sizeof(Header)) {
+		close(fd);
+		return;
+	}
+	size = std::uint64_t(st.st_size);
+	Map(fd, false);
+	if (data == nullptr) {
+		return;
+	}
+	const Header& header = GetHeader();
+	if (!std::equal(header.Magic, header.Magic + sizeof(LiveStateMagic), LiveStateMagic) || Align(sizeof(Header)) + header.SlotSize * header.Slots > size) {
+		munmap(data, std::size_t(size));
+		data = nullptr;
+	}
+#endif // !_WIN32
+}
+
+//destructor
+LiveStatePackage::~LiveStatePackage() {
+#ifndef _WIN32
+	if (data != nullptr) {
+		munmap(data, std::size_t(size));
+	}
+	if (created && data != nullptr) {
+		shm_unlink(Name.c_str());
+	}
+#endif // !_WIN32
+}
+
+bool LiveStatePackage::IsOpen() const {
+	return data != nullptr;
+}
+
+/*
+	The process ID of the running simulation that kept the shared memory from being created, 0 if none.
+*/
+std::int64_t LiveStatePackage::GetRunningOwner() const {
+	return runningOwner;
+}
+
+const LiveStatePackage::Header& LiveStatePackage::GetHeader() const {
+	return *reinterpret_cast<const Header*>(data);
+}
+
+/*
+	Take a free slot for N. -1 if there is none.
+*/
+int LiveStatePackage::Acquire(const int& N) {
+	if (data == nullptr || N > int(GetHeader().MaxCars)) {
+		return -1;
+	}
+	for (int i = 0; i < int(GetHeader().Slots); i++) {
+		std::uint32_t free = 0;
+		if (GetSlot(i)->Owner.compare_exchange_strong(free, 1)) {
+			return i;
+		}
+	}
+	return -1;
+}
+
+void LiveStatePackage::Release(const int& slot) {
+	if (data == nullptr || slot < 0) {
+		return;
+	}
+	SlotHeader* const slotHeader = GetSlot(slot);
+	slotHeader->Sequence.fetch_add(1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+	slotHeader->N = 0;
+	slotHeader->Sequence.fetch_add(1, std::memory_order_release);
+	slotHeader->Owner.store(0);
+}
+
+/*
+	Write the state of the slot. This never waits.
+	The sequence is odd while the values are written, so the readers retry.
+*/
+void LiveStatePackage::Publish(const int& slot, const Progress& progress, const std::vector<CarStruct*>& cars, const std::vector<double>& accelerations) {
+	if (data == nullptr || slot < 0) {
+		return;
+	}
+	SlotHeader* const slotHeader = GetSlot(slot);
+	double* const x = Values(slotHeader, 0);
+	double* const v = Values(slotHeader, 1);
+	double* const a = Values(slotHeader, 2);
+	std::uint8_t* const pedals = Pedals(slotHeader);
+	slotHeader->Sequence.fetch_add(1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+	double sumV = 0;
+	int stopped = 0;
+	for (std::size_t i = 0; i < cars.size(); i++) {
+		const CarStruct* const car = cars[i];
+		x[i] = car->Moment->x;
+		v[i] = car->Moment->v;
+		a[i] = i < accelerations.size() ? accelerations[i] : car->Moment->a;
+		const DriverElements::MomentValuesElements::PedalInformations* const pedal = car->Driver->Moment->pedal;
+		pedals[i] = std::uint8_t(pedal->footPosition) + (pedal->changing ? PedalChanging : 0);
+		sumV += v[i];
+		if (v[i] == 0) {
+			stopped++;
+		}
+	}
+	slotHeader->N = std::int32_t(cars.size());
+	slotHeader->Phase = progress.Phase;
+	slotHeader->MeasureNumber = progress.MeasureNumber;
+	slotHeader->CompletedMeasurements = progress.CompletedMeasurements;
+	slotHeader->Step = progress.Step;
+	slotHeader->Time = progress.Time;
+	slotHeader->Counter = progress.Counter;
+	slotHeader->StoppedCars = stopped;
+	slotHeader->LocalV = Calculate_m_s_To_Km_h(progress.LocalV);
+	slotHeader->MeanV = cars.empty() ? 0 : Calculate_m_s_To_Km_h(sumV / double(cars.size()));
+	slotHeader->WallTime = std::chrono::duration<double>(std::chrono::system_clock::now().time_since_epoch()).count();
+	slotHeader->Sequence.fetch_add(1, std::memory_order_release);
+}
+
+/*
+	Copy a consistent state of the slot. Return false if it was always being written.
+*/
+bool LiveStatePackage::Read(const int& slot, State& state, const int& maxRetries) const {
+	if (data == nullptr || slot < 0 || slot >= int(GetHeader().Slots)) {
+		return false;
+	}
+	SlotHeader* const slotHeader = GetSlot(slot);
+	for (int retry = 0; retry < maxRetries; retry++) {
+		const std::uint32_t&& begin = slotHeader->Sequence.load(std::memory_order_acquire);
+		if (begin % 2 != 0) {
+			continue;
+		}
+		const std::size_t&& n = std::size_t((std::min)(std::uint32_t((std::max)(slotHeader->N, 0)), GetHeader().MaxCars));
+		state.N = std::int32_t(n);
+		state.Phase = slotHeader->Phase;
+		state.MeasureNumber = slotHeader->MeasureNumber;
+		state.CompletedMeasurements = slotHeader->CompletedMeasurements;
+		state.Step = slotHeader->Step;
+		state.Time = slotHeader->Time;
+		state.Counter = slotHeader->Counter;
+		state.StoppedCars = slotHeader->StoppedCars;
+		state.LocalV = slotHeader->LocalV;
+		state.MeanV = slotHeader->MeanV;
+		state.WallTime = slotHeader->WallTime;
+		state.X.assign(Values(slotHeader, 0), Values(slotHeader, 0) + n);
+		state.V.assign(Values(slotHeader, 1), Values(slotHeader, 1) + n);
+		state.A.assign(Values(slotHeader, 2), Values(slotHeader, 2) + n);
+		state.Pedal.assign(Pedals(slotHeader), Pedals(slotHeader) + n);
+		std::atomic_thread_fence(std::memory_order_acquire);
+		if (slotHeader->Sequence.load(std::memory_order_relaxed) == begin) {
+			return true;
+		}
+	}
+	return false;
+}
+
+std::string LiveStatePackage::GetName(const int& IniFileNumber, const int& RunNumber) {
+	return "/ctfm_Ini" + std::to_string(IniFileNumber) + (RunNumber == 0 ? "" : "_RunN" + std::to_string(RunNumber));
+}
+
+/*
+	The process ID of the running simulation that created the shared memory, 0 if none.
+	The process ID is written before the magic, so it is read even if the creator crashed before the magic was written.
+	A process that exists but cannot be signaled (EPERM) is running.
+*/
+std::int64_t LiveStatePackage::FindRunningOwner(const std::string& Name) {
+#ifndef _WIN32
+	const int&& fd = shm_open(Name.c_str(), O_RDONLY, 0);
+	if (fd < 0) {
+		return 0;
+	}
+	struct stat st;
+	if (fstat(fd, &st) != 0 || std::uint64_t(st.st_size) < sizeof(Header)) {
+		close(fd);
+		return 0;
+	}
+	void* const mapped = mmap(nullptr, sizeof(Header), PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+	if (mapped == MAP_FAILED) {
+		return 0;
+	}
+	const std::int64_t processID = static_cast<const Header*>(mapped)->ProcessID;
+	munmap(mapped, sizeof(Header));
+	if (processID <= 0 || processID == std::int64_t(getpid())) {
+		return 0;
+	}
+	if (kill(pid_t(processID), 0) == 0 || errno == EPERM) {
+		return processID;
+	}
+#else
+	(void)Name;
+#endif // !_WIN32
+	return 0;
+}
+
+void LiveStatePackage::Map(const int& fd, const bool& writable) {
+#ifndef _WIN32
+	void* const mapped = mmap(nullptr, std::size_t(size), writable ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);	//The mapping is kept after the descriptor is closed.
+	data = mapped == MAP_FAILED ? nullptr : static_cast<char*>(mapped);
+#else
+	(void)fd;
+	(void)writable;
+#endif // !_WIN32
+}
+
+LiveStatePackage::SlotHeader* LiveStatePackage::GetSlot(const int& slot) const {
+	return reinterpret_cast<SlotHeader*>(data + Align(sizeof(Header)) + GetHeader().SlotSize * std::uint64_t(slot));
+}
+
+/*
+	x, v, a
+*/
+double* LiveStatePackage::Values(SlotHeader* const slotHeader, const std::size_t& channel) const {
+	return reinterpret_cast<double*>(reinterpret_cast<char*>(slotHeader) + sizeof(SlotHeader)) + channel * GetHeader().MaxCars;
+}
+
+std::uint8_t* LiveStatePackage::Pedals(SlotHeader* const slotHeader) const {
+	return reinterpret_cast<std::uint8_t*>(Values(slotHeader, 3));
+}
@@ -0,0 +1,116 @@
+/*
+	This is header file of the class of "LiveStatePackage" that publishes the states of the simulations in progress to a POSIX shared memory, so that the other processes can watch them.
+	The simulation creates the shared memory "/ctfm_Ini<n>" (or "/ctfm_Ini<n>_RunN<run>"), and each worker thread publishes its N to a slot at the configured interval of time steps.
+	A slot is protected by a sequence lock. The step loop never waits for the readers, and a reader retries when the slot was updated while it was read.
+	No file is written, and the shared memory is removed when the simulation finishes.
+	The shared memory left by a crashed simulation is replaced, but that of a running simulation is kept, and nothing is published then.
+	The shared memory is not supported on Windows, and nothing is published there.
+	Layout:
+		Header: char[8] magic "CTFMLIV1", uint32 slots, uint32 max cars, int32 ini file number, int32 run number, float64 L, float64 deltaT, uint64 slot size, int64 process ID
+		Slots: SlotHeader, then float64 x[max cars], float64 v[max cars], float64 a[max cars], uint8 pedal[max cars]
+*/
+
+#ifndef LIVESTATEPACKAGE_H
+#define LIVESTATEPACKAGE_H
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "CarStruct.h"
+
+class LiveStatePackage {
+public:
+	struct Header {
+		char Magic[8];
+		std::uint32_t Slots;
+		std::uint32_t MaxCars;
+		std::int32_t IniFileNumber;
+		std::int32_t RunNumber;
+		double L;	//m
+		double deltaT;	//s
+		std::uint64_t SlotSize;	//bytes
+		std::int64_t ProcessID;
+	};
+
+	//The values of a slot except the cars
+	struct SlotHeader {
+		std::atomic<std::uint32_t> Sequence;	//Odd while the slot is written.
+		std::atomic<std::uint32_t> Owner;	//1 while a worker uses the slot. This is not protected by "Sequence".
+		std::int32_t N;	//0 if the slot is not used.
+		std::int32_t Phase;	//0:run-up 1:measurement
+		std::int32_t MeasureNumber;	//1-based, 0 during the run-up
+		std::int32_t CompletedMeasurements;
+		std::int64_t Step;	//Time steps within the phase
+		double Time;	//s, elapsed time within the phase
+		std::int32_t Counter;	//The cars passed the measurement section in the current measurement
+		std::int32_t StoppedCars;	//v = 0
+		double LocalV;	//km/h. The average velocity in the measurement section in the current measurement.
+		double MeanV;	//km/h. The average velocity of all cars.
+		double WallTime;	//s since the epoch when the slot was written
+	};
+
+	//A copy of a slot read by "Read"
+	struct State {
+		std::int32_t N;
+		std::int32_t Phase;
+		std::int32_t MeasureNumber;
+		std::int32_t CompletedMeasurements;
+		std::int64_t Step;
+		double Time;
+		std::int32_t Counter;
+		std::int32_t StoppedCars;
+		double LocalV;
+		double MeanV;
+		double WallTime;
+		std::vector<double> X;
+		std::vector<double> V;
+		std::vector<double> A;
+		std::vector<std::uint8_t> Pedal;	//FootPositionType, +4 while the pedal is being changed
+	};
+
+	//The values published by the step loop with the cars
+	struct Progress {
+		std::int32_t Phase;
+		std::int32_t MeasureNumber;
+		std::int32_t CompletedMeasurements;
+		std::int64_t Step;
+		double Time;
+		std::int32_t Counter;
+		double LocalV;	//m/s
+	};
+
+	static const std::uint8_t PedalChanging = 4;
+
+	LiveStatePackage(const std::string& Name, const int& Interval, const int& Slots, const int& MaxCars, const int& IniFileNumber, const int& RunNumber, const double& L, const double& deltaT);	//constructor of the simulation. The shared memory is created.
+	LiveStatePackage(const std::string& Name);	//constructor of a reader. The shared memory is opened to read.
+	~LiveStatePackage();	//destructor. The shared memory created by this is removed.
+
+	LiveStatePackage(const LiveStatePackage&) = delete;
+	LiveStatePackage& operator=(const LiveStatePackage&) = delete;
+
+	const int Interval;	//Time steps between the updates. 0 for a reader.
+
+	bool IsOpen() const;
+	std::int64_t GetRunningOwner() const;	//The process ID of the running simulation that kept the shared memory from being created, 0 if none.
+	const Header& GetHeader() const;
+	int Acquire(const int& N);	//Take a free slot for N. -1 if there is none.
+	void Release(const int& slot);
+	void Publish(const int& slot, const Progress& progress, const std::vector<CarStruct*>& cars, const std::vector<double>& accelerations);	//Write the state of the slot. This never waits.
+	bool Read(const int& slot, State& state, const int& maxRetries = 1000) const;	//Copy a consistent state of the slot. Return false if it was always being written.
+
+	static std::string GetName(const int& IniFileNumber, const int& RunNumber);
+private:
+	const std::string Name;
+	const bool created;
+	char* data;
+	std::uint64_t size;
+	std::int64_t runningOwner;
+
+	static std::int64_t FindRunningOwner(const std::string& Name);	//The process ID of the running simulation that created the shared memory, 0 if none.
+	void Map(const int& fd, const bool& writable);
+	SlotHeader* GetSlot(const int& slot) const;
+	double* Values(SlotHeader* const slotHeader, const std::size_t& channel) const;	//x, v, a
+	std::uint8_t* Pedals(SlotHeader* const slotHeader) const;
+};
+
+#endif // !LIVESTATEPACKAGE_H
@@ -0,0 +1,74 @@
+/*
+	This is header file of the class of "MPSCQueuePackage" that is a lock-free queue with multiple producers and a single consumer.
+	Push never waits for the other producers or the consumer, so the worker threads can pass their results without blocking.
+	Only one thread may call Pop.
+
+	reference
+	Dmitry Vyukov
+	Intrusive MPSC node-based queue
+	https://www.1024cores.net/home/lock-free-algorithms/queues/intrusive-mpsc-node-based-queue
+*/
+
+#ifndef MPSCQUEUEPACKAGE_H
+#define MPSCQUEUEPACKAGE_H
+#include <atomic>
+#include <utility>
+
+template<class _T>
+class MPSCQueuePackage {
+	struct Node {
+		std::atomic<Node*> next;
+		_T value;
+	};
+
+	std::atomic<Node*> head;	//The node pushed last
+	Node* tail;	//The node popped last. Its value has been moved out.
+public:
+	//constructor
+	MPSCQueuePackage() {
+		Node* const stub = new Node();
+		stub->next.store(nullptr, std::memory_order_relaxed);
+		head.store(stub, std::memory_order_relaxed);
+		tail = stub;
+	}
+
+	//destructor
+	~MPSCQueuePackage() {
+		while (tail != nullptr) {
+			Node* const next = tail->next.load(std::memory_order_relaxed);
+			delete tail;
+			tail = next;
+		}
+	}
+
+	MPSCQueuePackage(const MPSCQueuePackage&) = delete;
+	MPSCQueuePackage& operator=(const MPSCQueuePackage&) = delete;
+
+	/*
+		This can be called by any thread at the same time.
+	*/
+	void Push(_T&& value) {
+		Node* const node = new Node();
+		node->next.store(nullptr, std::memory_order_relaxed);
+		node->value = std::move(value);
+		Node* const previous = head.exchange(node, std::memory_order_acq_rel);
+		previous->next.store(node, std::memory_order_release);
+	}
+
+	/*
+		If the queue is empty, return false.
+		A value being pushed may not be seen yet, and it is popped at the next call.
+	*/
+	bool Pop(_T& value) {
+		Node* const next = tail->next.load(std::memory_order_acquire);
+		if (next == nullptr) {
+			return false;
+		}
+		value = std::move(next->value);
+		delete tail;
+		tail = next;
+		return true;
+	}
+};
+
+#endif // !MPSCQUEUEPACKAGE_H
@@ -0,0 +1,224 @@
+/*
+	This is cpp file of the class of "ManifestPackage" that records the progress of each N of an ini file and a run number to a binary file.
+*/
+
+#include "ManifestPackage.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include "HashPackage.h"
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif // _WIN32
+
+namespace {
+	const char ManifestMagic[8] = { 'C', 'T', 'F', 'M', 'M', 'A', 'N', '1' };
+	const std::size_t HeaderSize = sizeof(ManifestMagic) + sizeof(std::uint32_t);
+	const std::size_t ChecksumOffset = ManifestPackage::RecordSize - sizeof(std::uint64_t);
+
+	template<typename _T>
+	void Put(char*& p, const _T& val) {
+		std::memcpy(p, &val, sizeof(_T));
+		p += sizeof(_T);
+	}
+
+	template<typename _T>
+	void Take(const char*& p, _T& val) {
+		std::memcpy(&val, p, sizeof(_T));
+		p += sizeof(_T);
+	}
+
+	std::uint64_t Checksum(const char* const record) {
+		HashPackage hash;
+		hash.Add(record, ChecksumOffset);
+		return hash.Value();
+	}
+}
+
+//constructor
+ManifestPackage::Entry::Entry()
+	: N(0), Status(NotStarted), Seed(0), Attempts(0), WallTime(0), V(0), LocalStandardDeviation(0)
+	, FDOffset(0), GlobalVDOffset(0), LocalVDOffset(0), FDSize(0), GlobalVDSize(0), LocalVDSize(0) { }
+
+/*
+	The records are read, and the file is created if it does not exist.
+	If the file is not a manifest of this version, it is started over.
+*/
+ManifestPackage::ManifestPackage(const std::string& path) {
+	opened = false;
+	const bool&& valid = Read(path, entries);
+	if (!valid) {
+		entries.clear();
+	}
+#ifdef _WIN32
+	fileHandle = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, valid ? OPEN_ALWAYS : CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (fileHandle == INVALID_HANDLE_VALUE) {
+		fileHandle = nullptr;
+		return;
+	}
+#else
+	fd = open(path.c_str(), O_RDWR | O_CREAT | (valid ? 0 : O_TRUNC), 0644);
+	if (fd < 0) {
+		return;
+	}
+#endif // _WIN32
+	opened = true;
+	if (!valid) {
+		char header[HeaderSize];
+		const std::uint32_t&& recordSize = std::uint32_t(RecordSize);
+		std::memcpy(header, ManifestMagic, sizeof(ManifestMagic));
+		std::memcpy(header + sizeof(ManifestMagic), &recordSize, sizeof(std::uint32_t));
+		opened = WriteAt(header, HeaderSize, 0);
+	}
+}
+
+//destructor
+ManifestPackage::~ManifestPackage() {
+#ifdef _WIN32
+	if (fileHandle != nullptr) {
+		CloseHandle(fileHandle);
+	}
+#else
+	if (fd >= 0) {
+		close(fd);
+	}
+#endif // _WIN32
+}
+
+bool ManifestPackage::IsOpen() const {
+	return opened;
+}
+
+/*
+	No record has been written.
+*/
+bool ManifestPackage::Empty() const {
+	return std::none_of(entries.begin(), entries.end(), [](const Entry& entry) { return entry.Status != NotStarted; });
+}
+
+/*
+	The record read when this was constructed. "NotStarted" if there is no valid record.
+*/
+ManifestPackage::Entry ManifestPackage::Get(const int& N) const {
+	if (N >= 1 && std::size_t(N) <= entries.size()) {
+		return entries[std::size_t(N - 1)];
+	}
+	Entry entry;
+	entry.N = N;
+	return entry;
+}
+
+/*
+	Write the record atomically. This can be called by the threads at the same time for the different N.
+*/
+bool ManifestPackage::Write(const Entry& entry) {
+	if (!opened || entry.N < 1) {
+		return false;
+	}
+	char record[RecordSize];
+	Encode(entry, record);
+	return WriteAt(record, RecordSize, HeaderSize + std::uint64_t(entry.N - 1) * RecordSize);
+}
+
+/*
+	Read the records of a manifest file. The invalid records are "NotStarted".
+	If the file is not a manifest of this version, return false.
+*/
+bool ManifestPackage::Read(const std::string& path, std::vector<Entry>& entries) {
+	entries.clear();
+	std::ifstream ifs(path, std::ios::binary);
+	if (!ifs) {
+		return false;
+	}
+	char magic[sizeof(ManifestMagic)];
+	std::uint32_t recordSize;
+	ifs.read(magic, sizeof(magic));
+	ifs.read(reinterpret_cast<char*>(&recordSize), sizeof(recordSize));
+	if (!ifs || !std::equal(magic, magic + sizeof(magic), ManifestMagic) || recordSize != RecordSize) {
+		return false;
+	}
+	char record[RecordSize];
+	while (ifs.read(record, RecordSize)) {
+		Entry entry;
+		if (!Decode(record, entry) || entry.N != int(entries.size() + 1)) {
+			entry = Entry();
+			entry.N = int(entries.size() + 1);
+		}
+		entries.emplace_back(entry);
+	}
+	return true;
+}
+
+std::string ManifestPackage::StatusToString(const std::uint32_t& status) {
+	switch (status) {
+	case Running:
+		return "running";
+	case Done:
+		return "done";
+	case Failed:
+		return "failed";
+	case NotStarted:
+	default:
+		return "not started";
+	}
+}
+
+bool ManifestPackage::WriteAt(const char* const data, const std::size_t& size, const std::uint64_t& offset) {
+#ifdef _WIN32
+	OVERLAPPED overlapped = {};
+	overlapped.Offset = DWORD(offset & 0xFFFFFFFF);
+	overlapped.OffsetHigh = DWORD(offset >> 32);
+	DWORD written = 0;
+	return WriteFile(fileHandle, data, DWORD(size), &written, &overlapped) && written == DWORD(size);
+#else
+	return pwrite(fd, data, size, off_t(offset)) == ssize_t(size);
+#endif // _WIN32
+}
+
+void ManifestPackage::Encode(const Entry& entry, char* const record) {
+	char* p = record;
+	Put(p, entry.N);
+	Put(p, entry.Status);
+	Put(p, entry.Seed);
+	Put(p, entry.Attempts);
+	Put(p, entry.WallTime);
+	Put(p, entry.V);
+	Put(p, entry.LocalStandardDeviation);
+	Put(p, entry.FDOffset);
+	Put(p, entry.GlobalVDOffset);
+	Put(p, entry.LocalVDOffset);
+	Put(p, entry.FDSize);
+	Put(p, entry.GlobalVDSize);
+	Put(p, entry.LocalVDSize);
+	Put(p, std::uint32_t(0));
+	Put(p, Checksum(record));
+}
+
+/*
+	If the record is torn or it has not been written, return false.
+*/
+bool ManifestPackage::Decode(const char* const record, Entry& entry) {
+	std::uint64_t checksum;
+	std::memcpy(&checksum, record + ChecksumOffset, sizeof(checksum));
+	if (checksum != Checksum(record)) {
+		return false;
+	}
+	const char* p = record;
+	Take(p, entry.N);
+	Take(p, entry.Status);
+	Take(p, entry.Seed);
+	Take(p, entry.Attempts);
+	Take(p, entry.WallTime);
+	Take(p, entry.V);
+	Take(p, entry.LocalStandardDeviation);
+	Take(p, entry.FDOffset);
+	Take(p, entry.GlobalVDOffset);
+	Take(p, entry.LocalVDOffset);
+	Take(p, entry.FDSize);
+	Take(p, entry.GlobalVDSize);
+	Take(p, entry.LocalVDSize);
+	return entry.Status <= Failed;
+}
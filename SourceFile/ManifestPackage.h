@@ -0,0 +1,79 @@
+/*
+	This is header file of the class of "ManifestPackage" that records the progress of each N of an ini file and a run number to a binary file.
+	The file has a record of a fixed size for each N at the offset decided by N, so the state of an N is read and written without the others.
+	A record is written by a single positioned write (pwrite), so the worker threads and the output thread update the records of different N at the same time without a lock.
+	Each record has a checksum, and the record torn by a crash is read as "NotStarted".
+	Format:
+		char[8] magic "CTFMMAN1", uint32 record size
+		The records of N=1, 2, ...:
+			int32 N, uint32 status, uint32 seed, uint32 attempts
+			float64 wall time (s), float64 V (km/h), float64 standard deviation of the local V (km/h)
+			uint64 offsets of the lines in FD, Global_VD and Local_VD
+			uint32 bytes of the lines in FD, Global_VD and Local_VD, uint32 0
+			uint64 checksum of the bytes above
+*/
+
+#ifndef MANIFESTPACKAGE_H
+#define MANIFESTPACKAGE_H
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class ManifestPackage {
+public:
+	enum Status : std::uint32_t {
+		NotStarted = 0,
+		Running = 1,	//The simulation has been started, but it has been neither finished nor failed. It is interrupted or crashed if this is read at the start.
+		Done = 2,	//The results have been written to the result files.
+		Failed = 3	//The cars collided in all attempts, or the cars could not be placed on the road.
+	};
+
+	//The record of an N
+	struct Entry {
+		std::int32_t N;
+		std::uint32_t Status;
+		std::uint32_t Seed;
+		std::uint32_t Attempts;	//The simulations of this N in all executions
+		double WallTime;	//s. The time taken by the last execution.
+		double V;	//km/h. Valid when it is "Done".
+		double LocalStandardDeviation;	//km/h. Valid when it is "Done".
+		std::uint64_t FDOffset;	//The offsets and the bytes of the lines of this N in the result files. Valid when it is "Done".
+		std::uint64_t GlobalVDOffset;
+		std::uint64_t LocalVDOffset;
+		std::uint32_t FDSize;
+		std::uint32_t GlobalVDSize;
+		std::uint32_t LocalVDSize;
+
+		Entry();	//constructor. "NotStarted"
+	};
+
+	static const std::size_t RecordSize = 88;	//bytes
+
+	ManifestPackage(const std::string& path);	//constructor. The records are read, and the file is created if it does not exist.
+	~ManifestPackage();	//destructor
+
+	ManifestPackage(const ManifestPackage&) = delete;
+	ManifestPackage& operator=(const ManifestPackage&) = delete;
+
+	bool IsOpen() const;
+	bool Empty() const;	//No record has been written.
+	Entry Get(const int& N) const;	//The record read when this was constructed. "NotStarted" if there is no valid record.
+	bool Write(const Entry& entry);	//Write the record atomically. This can be called by the threads at the same time for the different N.
+
+	static bool Read(const std::string& path, std::vector<Entry>& entries);	//Read the records of a manifest file. The invalid records are "NotStarted".
+	static std::string StatusToString(const std::uint32_t& status);
+private:
+	std::vector<Entry> entries;
+	bool opened;
+#ifdef _WIN32
+	void* fileHandle;
+#else
+	int fd;
+#endif // _WIN32
+
+	bool WriteAt(const char* const data, const std::size_t& size, const std::uint64_t& offset);
+	static void Encode(const Entry& entry, char* const record);
+	static bool Decode(const char* const record, Entry& entry);
+};
+
+#endif // !MANIFESTPACKAGE_H
@@ -0,0 +1,132 @@
+/*
+	This is cpp file of the class of "MappedFilePackage" that maps a whole file to the memory to read it.
+*/
+
+#include "MappedFilePackage.h"
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // _WIN32
+
+//constructor
+MappedFilePackage::StreamBuffer::StreamBuffer(const char* const data, const std::uint64_t& size) {
+	char* const begin = const_cast<char*>(data);	//The buffer is only read.
+	setg(begin, begin, begin + size);
+}
+
+MappedFilePackage::StreamBuffer::pos_type MappedFilePackage::StreamBuffer::seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) {
+	if ((which & std::ios_base::in) == 0) {
+		return pos_type(off_type(-1));
+	}
+	char* position;
+	switch (dir) {
+	case std::ios_base::beg:
+		position = eback() + off;
+		break;
+	case std::ios_base::end:
+		position = egptr() + off;
+		break;
+	case std::ios_base::cur:
+	default:
+		position = gptr() + off;
+		break;
+	}
+	if (position < eback() || position > egptr()) {
+		return pos_type(off_type(-1));
+	}
+	setg(eback(), position, egptr());
+	return pos_type(off_type(position - eback()));
+}
+
+MappedFilePackage::StreamBuffer::pos_type MappedFilePackage::StreamBuffer::seekpos(pos_type pos, std::ios_base::openmode which) {
+	return seekoff(off_type(pos), std::ios_base::beg, which);
+}
+
+/*
+	If the file cannot be mapped, "IsOpen" is false.
+	An empty file is open with no data.
+*/
+MappedFilePackage::MappedFilePackage(const std::string& path) {
+	data = nullptr;
+	size = 0;
+	opened = false;
+#ifdef _WIN32
+	mappingHandle = nullptr;
+	fileHandle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (fileHandle == INVALID_HANDLE_VALUE) {
+		fileHandle = nullptr;
+		return;
+	}
+	LARGE_INTEGER fileSize;
+	if (!GetFileSizeEx(fileHandle, &fileSize)) {
+		return;
+	}
+	size = std::uint64_t(fileSize.QuadPart);
+	if (size > 0) {
+		mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (mappingHandle == nullptr) {
+			return;
+		}
+		data = static_cast<const char*>(MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0));
+		if (data == nullptr) {
+			return;
+		}
+	}
+#else
+	const int&& fd = open(path.c_str(), O_RDONLY);
+	if (fd < 0) {
+		return;
+	}
+	struct stat st;
+	if (fstat(fd, &st) != 0) {
+		close(fd);
+		return;
+	}
+	size = std::uint64_t(st.st_size);
+	if (size > 0) {
+		void* const mapped = mmap(nullptr, std::size_t(size), PROT_READ, MAP_SHARED, fd, 0);
+		if (mapped == MAP_FAILED) {
+			close(fd);
+			return;
+		}
+		data = static_cast<const char*>(mapped);
+	}
+	close(fd);	//The mapping is kept after the file is closed.
+#endif // _WIN32
+	opened = true;
+}
+
+//destructor
+MappedFilePackage::~MappedFilePackage() {
+#ifdef _WIN32
+	if (data != nullptr) {
+		UnmapViewOfFile(data);
+	}
+	if (mappingHandle != nullptr) {
+		CloseHandle(mappingHandle);
+	}
+	if (fileHandle != nullptr) {
+		CloseHandle(fileHandle);
+	}
+#else
+	if (data != nullptr) {
+		munmap(const_cast<char*>(data), std::size_t(size));
+	}
+#endif // _WIN32
+}
+
+bool MappedFilePackage::IsOpen() const {
+	return opened;
+}
+
+const char* MappedFilePackage::Data() const {
+	return data;
+}
+
+std::uint64_t MappedFilePackage::Size() const {
+	return size;
+}
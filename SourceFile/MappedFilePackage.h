@@ -0,0 +1,44 @@
+/*
+	This is header file of the class of "MappedFilePackage" that maps a whole file to the memory to read it.
+	The pages are read from the disk when they are accessed, so only the accessed part of a large file is read, and the data are not copied to a buffer.
+	This absorbs the difference between POSIX (mmap) and Windows (CreateFileMapping).
+*/
+
+#ifndef MAPPEDFILEPACKAGE_H
+#define MAPPEDFILEPACKAGE_H
+#include <cstdint>
+#include <iostream>
+#include <streambuf>
+#include <string>
+
+class MappedFilePackage {
+public:
+	//The stream that reads the mapped memory without copying it, for the functions that read from "std::istream".
+	class StreamBuffer : public std::streambuf {
+	public:
+		StreamBuffer(const char* const data, const std::uint64_t& size);	//constructor
+	protected:
+		pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override;
+		pos_type seekpos(pos_type pos, std::ios_base::openmode which) override;
+	};
+
+	MappedFilePackage(const std::string& path);	//constructor. If the file cannot be mapped, "IsOpen" is false.
+	~MappedFilePackage();	//destructor
+
+	MappedFilePackage(const MappedFilePackage&) = delete;
+	MappedFilePackage& operator=(const MappedFilePackage&) = delete;
+
+	bool IsOpen() const;
+	const char* Data() const;
+	std::uint64_t Size() const;
+private:
+	const char* data;
+	std::uint64_t size;
+	bool opened;
+#ifdef _WIN32
+	void* fileHandle;
+	void* mappingHandle;
+#endif // _WIN32
+};
+
+#endif // !MAPPEDFILEPACKAGE_H
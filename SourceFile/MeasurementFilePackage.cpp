@@ -0,0 +1,46 @@
+/*
+	This is cpp file of the class of "MeasurementFilePackage" that names and writes the file of each measurement of the space-time field, the jam events and the time series.
+*/
+
+#include "MeasurementFilePackage.h"
+
+//constructor
+MeasurementFilePackage::MeasurementFilePackage(const std::string& FolderPath, const int& IniFileNumber, const int& RunNumber, const std::string& Name) {
+	const std::string&& folderPath = FolderPath + R"(/Ini)" + std::to_string(IniFileNumber);
+	FileSystem::MakeDirectories(folderPath);
+	if (RunNumber == 0) {
+		FileNameBase = folderPath + R"(/)" + Name;
+	}
+	else {
+		FileNameBase = folderPath + R"(/)" + Name + "_RunN" + std::to_string(RunNumber);
+	}
+}
+
+//destructor
+MeasurementFilePackage::~MeasurementFilePackage() { }
+
+/*
+	"Extension" is with the dot.
+*/
+std::string MeasurementFilePackage::Path(const int& N, const int& MeasureNumber, const std::string& Extension) const {
+	return FileNameBase + "_N" + std::to_string(N) + "_MeasureN" + std::to_string(MeasureNumber) + Extension;
+}
+
+/*
+	Replace the file with what "write" writes. Return false if the file cannot be written.
+	The existing file is kept until the new one has been written completely.
+*/
+bool MeasurementFilePackage::Write(const std::string& path, const bool& binary, const std::function<void(std::ostream&)>& write) const {
+	const std::string&& tmpPath = FileSystem::TemporaryPath(path);
+	std::ofstream ofs(tmpPath, binary ? std::ios::binary | std::ios::trunc : std::ios::trunc);
+	if (!ofs) {
+		return false;
+	}
+	write(ofs);
+	ofs.close();
+	if (!ofs || !FileSystem::ReplaceFile(tmpPath, path)) {
+		FileSystem::RemoveFile(tmpPath);
+		return false;
+	}
+	return true;
+}
@@ -0,0 +1,26 @@
+/*
+	This is header file of the class of "MeasurementFilePackage" that names and writes the file of each measurement of the space-time field, the jam events and the time series.
+	The files are "<Folder>/Ini<n>/<Name>_N<N>_MeasureN<measure>" (with "_RunN<run>" after the name).
+	A file is written to a temporary file and renamed, so a crash while writing never leaves a torn file.
+*/
+
+#ifndef MEASUREMENTFILEPACKAGE_H
+#define MEASUREMENTFILEPACKAGE_H
+#include <fstream>
+#include <functional>
+#include <ostream>
+#include <string>
+#include "FileSystemPackage.h"
+
+class MeasurementFilePackage {
+public:
+	MeasurementFilePackage(const std::string& FolderPath, const int& IniFileNumber, const int& RunNumber, const std::string& Name);	//constructor. The folder is created here.
+	~MeasurementFilePackage();	//destructor
+
+	std::string Path(const int& N, const int& MeasureNumber, const std::string& Extension) const;	//"Extension" is with the dot.
+	bool Write(const std::string& path, const bool& binary, const std::function<void(std::ostream&)>& write) const;	//Replace the file with what "write" writes. Return false if the file cannot be written.
+private:
+	std::string FileNameBase;
+};
+
+#endif // !MEASUREMENTFILEPACKAGE_H
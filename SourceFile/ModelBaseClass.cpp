@@ -9,10 +9,10 @@
 /*
 	This constructor is only called by "AdvanceTimeAndMeasureClass".
 */
-ModelBaseClass::ModelBaseClass(const int& RunNumber, const int& N, const ModelParametersClass& ModelParameters, const StatisticsParametersClass& StatisticsParameters)
+ModelBaseClass::ModelBaseClass(const unsigned int& Seed, const int& N, const ModelParametersClass& ModelParameters, const StatisticsParametersClass& StatisticsParameters)
 	: N(N), ModelParameters(ModelParameters), StatisticsParameters(StatisticsParameters)
 	, cars(new std::vector<CarStruct*>(N))
-	, random(new Random(RunNumber)) {
+	, random(new Random(Seed)) {
 	calledBy = CalledBy::Constructor;
 	deletedCars = false;
 	deletedRandom = false;
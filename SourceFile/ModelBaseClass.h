@@ -19,7 +19,7 @@
 
 class ModelBaseClass {
 public:
-	ModelBaseClass(const int& RunNumber, const int& N, const ModelParametersClass& ModelParameters, const StatisticsParametersClass& StatisticsParameters);	//This constructor is only called by "AdvanceTimeAndMeasureClass".
+	ModelBaseClass(const unsigned int& Seed, const int& N, const ModelParametersClass& ModelParameters, const StatisticsParametersClass& StatisticsParameters);	//This constructor is only called by "AdvanceTimeAndMeasureClass".
 	ModelBaseClass(const ModelBaseClass* const baseClass);	//This copy constructor is called from anything other than "AdvanceTimeAndMeasureClass".
 	~ModelBaseClass();	//destructor
 protected:
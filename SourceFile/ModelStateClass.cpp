@@ -0,0 +1,241 @@
+/*
+	This is cpp file of the class of "ModelStateClass" that writes the state of all cars, drivers and the random number generator to a binary stream and restores it.
+	This inherits from "ModelBaseClass".
+*/
+
+#include "ModelStateClass.h"
+
+namespace {
+	/*
+		Read a value shared by all cars or all drivers. If it differs from the shared one, the state is written for another profile.
+	*/
+	template<typename _T>
+	bool ReadShared(std::istream& is, const _T& shared) {
+		_T val;
+		return BinaryIO::Read(is, val) && val == shared;
+	}
+}
+
+//constructor
+ModelStateClass::ModelStateClass(const ModelBaseClass* const baseClass) : ModelBaseClass(baseClass) { }
+
+//destructor
+ModelStateClass::~ModelStateClass() { }
+
+/*
+	Write the state of all cars, drivers and the random number generator.
+*/
+void ModelStateClass::Write(std::ostream& os) const {
+	BinaryIO::Write(os, std::int32_t(N));
+	for (std::size_t i = 0; i < cars->size(); i++) {
+		WriteCar(os, (*cars)[i]);
+	}
+	BinaryIO::WriteString(os, random->SaveState());
+}
+
+/*
+	Restore the state written by "Write". If the stream is broken or written for another N or profile, return false and keep the current state.
+	The cars are overwritten as they are read, so the current state is written first and restored again when the stream fails on the way.
+*/
+bool ModelStateClass::Read(std::istream& is) const {
+	std::stringstream current;
+	Write(current);
+	if (Restore(is)) {
+		return true;
+	}
+	Restore(current);
+	return false;
+}
+
+bool ModelStateClass::Restore(std::istream& is) const {
+	std::int32_t n;
+	if (!BinaryIO::Read(is, n) || n != N) {
+		return false;
+	}
+	std::vector<std::size_t> rearIDs(N);
+	std::vector<std::size_t> frontIDs(N);
+	for (std::size_t i = 0; i < cars->size(); i++) {
+		if (!ReadCar(is, (*cars)[i], rearIDs[i], frontIDs[i])) {
+			return false;
+		}
+		if (rearIDs[i] >= std::size_t(N) || frontIDs[i] >= std::size_t(N)) {
+			return false;
+		}
+	}
+	std::string randomState;
+	if (!BinaryIO::ReadString(is, randomState) || !random->LoadState(randomState)) {
+		return false;
+	}
+
+	//Set pointers for the front and rear vehicles again, because the order of cars on the road may be different from the initialized one.
+	for (std::size_t i = 0; i < cars->size(); i++) {
+		CarElements::MomentValues* const carMoment = (*cars)[i]->Moment;
+		SafeDelete(carMoment->arround);
+		carMoment->arround = new CarElements::MomentValuesElements::Arround((*cars)[rearIDs[i]], (*cars)[frontIDs[i]]);
+		carMoment->UpdateReferences();
+	}
+	return true;
+}
+
+void ModelStateClass::WriteCar(std::ostream& os, const CarStruct* const car) const {
+	const CarElements::EigenValues* const carEigen = car->Eigen;
+	BinaryIO::Write(os, carEigen->Vmax);
+	BinaryIO::Write(os, carEigen->Amax->Plus);
+	BinaryIO::Write(os, carEigen->Amax->Minus);
+	BinaryIO::Write(os, carEigen->AResistance);
+	BinaryIO::Write(os, carEigen->Length);
+	BinaryIO::Write(os, carEigen->DriverMode);
+
+	const CarElements::MomentValues* const carMoment = car->Moment;
+	const CarElements::MomentValuesElements::GapSerise* const g = carMoment->g;
+	BinaryIO::Write(os, carMoment->a);
+	BinaryIO::Write(os, carMoment->v);
+	BinaryIO::Write(os, carMoment->x);
+	BinaryIO::Write(os, g->gap);
+	BinaryIO::Write(os, g->closest);
+	BinaryIO::Write(os, g->cruise);
+	BinaryIO::Write(os, g->influenced);
+	BinaryIO::Write(os, g->deltaGap->current);
+	BinaryIO::Write(os, g->deltaGap->last);
+	BinaryIO::Write(os, carMoment->measurement->passed);
+	BinaryIO::Write(os, carMoment->measurement->elapsedTime);
+	BinaryIO::Write(os, std::uint64_t(carMoment->arround->rear->ID));
+	BinaryIO::Write(os, std::uint64_t(carMoment->arround->front->ID));
+
+	WriteDriver(os, car->Driver);
+}
+
+bool ModelStateClass::ReadCar(std::istream& is, CarStruct* const car, std::size_t& rearID, std::size_t& frontID) const {
+	const CarElements::EigenValues* const carEigen = car->Eigen;
+	if (!ReadShared(is, carEigen->Vmax) || !ReadShared(is, carEigen->Amax->Plus) || !ReadShared(is, carEigen->Amax->Minus)
+		|| !ReadShared(is, carEigen->AResistance) || !ReadShared(is, carEigen->Length) || !ReadShared(is, carEigen->DriverMode)) {
+		return false;
+	}
+
+	CarElements::MomentValues* const carMoment = car->Moment;
+	CarElements::MomentValuesElements::GapSerise* const g = carMoment->g;
+	BinaryIO::Read(is, carMoment->a);
+	BinaryIO::Read(is, carMoment->v);
+	BinaryIO::Read(is, carMoment->x);
+	BinaryIO::Read(is, g->gap);
+	BinaryIO::Read(is, g->closest);
+	BinaryIO::Read(is, g->cruise);
+	BinaryIO::Read(is, g->influenced);
+	BinaryIO::Read(is, g->deltaGap->current);
+	BinaryIO::Read(is, g->deltaGap->last);
+	BinaryIO::Read(is, carMoment->measurement->passed);
+	BinaryIO::Read(is, carMoment->measurement->elapsedTime);
+	std::uint64_t id;
+	BinaryIO::Read(is, id);
+	rearID = std::size_t(id);
+	BinaryIO::Read(is, id);
+	frontID = std::size_t(id);
+
+	return ReadDriver(is, car->Driver);
+}
+
+void ModelStateClass::WriteDriver(std::ostream& os, const DriverStruct* const driver) const {
+	const DriverElements::EigenValues* const driverEigen = driver->Eigen;
+	const DriverElements::SampledValues& sampled = driver->Sampled;
+	//"Acceptable", "Strong" and "Normal" of the acceleration, the deceleration and the front deceleration. The values not used by the model are 0.
+	const double series[] = {
+		sampled.AccelerationAcceptable, 0, 0
+		, driverEigen->DecelerationAcceptable, sampled.DecelerationStrong, sampled.DecelerationNormal
+		, 0, 0, sampled.FrontDecelerationNormal
+	};
+	for (const double& val : series) {
+		BinaryIO::Write(os, val);
+	}
+	const Common::EigenValuesElements::UpperLower* const upperLowers[] = {
+		driverEigen->PedalChange->T->AccelToBrake, driverEigen->PedalChange->T->BrakeToAccel
+		, driverEigen->PedalChange->V->AccelToBrake, driverEigen->PedalChange->V->BrakeToAccel
+		, driverEigen->TMargin->V, driverEigen->TMargin->T
+	};
+	for (const Common::EigenValuesElements::UpperLower* const ul : upperLowers) {
+		BinaryIO::Write(os, ul->Upper);
+		BinaryIO::Write(os, ul->Lower);
+	}
+	BinaryIO::Write(os, driverEigen->V->Cruise);
+	BinaryIO::Write(os, driverEigen->V->DeltaAtCruise->Plus);
+	BinaryIO::Write(os, driverEigen->V->DeltaAtCruise->Minus);
+	BinaryIO::Write(os, driverEigen->V->DeltaAt0->Plus);
+	BinaryIO::Write(os, driverEigen->V->DeltaAt0->Minus);
+	BinaryIO::Write(os, driverEigen->G->Closest);
+	BinaryIO::Write(os, driverEigen->G->Cruise);
+	BinaryIO::Write(os, driverEigen->G->Influenced);
+
+	const DriverElements::MomentValues* const driverMoment = driver->Moment;
+	const DriverElements::MomentValuesElements::PedalInformations* const pedal = driverMoment->pedal;
+	BinaryIO::Write(os, driverMoment->a);
+	BinaryIO::Write(os, driverMoment->recognitionHit);
+	BinaryIO::Write(os, driverMoment->R->velocity);
+	BinaryIO::Write(os, driverMoment->R->gap);
+	BinaryIO::Write(os, pedal->needTime);
+	BinaryIO::Write(os, pedal->timeElapsed);
+	BinaryIO::Write(os, pedal->changing);
+	BinaryIO::Write(os, pedal->footPosition);
+	BinaryIO::Write(os, pedal->targetFootPosition);
+	BinaryIO::Write(os, pedal->t->accelToBrake);
+	BinaryIO::Write(os, pedal->t->brakeToAccel);
+	BinaryIO::Write(os, driverMoment->v->target);
+	BinaryIO::Write(os, driverMoment->v->delta->plus);
+	BinaryIO::Write(os, driverMoment->v->delta->minus);
+	BinaryIO::Write(os, driverMoment->v->deltaV->current);
+	BinaryIO::Write(os, driverMoment->v->deltaV->last);
+	BinaryIO::Write(os, driverMoment->g->baseFg);
+	BinaryIO::Write(os, driverMoment->g->baseNg);
+	BinaryIO::Write(os, driverMoment->g->emergency);
+}
+
+bool ModelStateClass::ReadDriver(std::istream& is, DriverStruct* const driver) const {
+	const DriverElements::EigenValues* const driverEigen = driver->Eigen;
+	DriverElements::SampledValues& sampled = driver->Sampled;
+	double series[9];
+	for (double& val : series) {
+		BinaryIO::Read(is, val);
+	}
+	if (!is || series[3] != driverEigen->DecelerationAcceptable) {
+		return false;
+	}
+	sampled.AccelerationAcceptable = series[0];
+	sampled.DecelerationStrong = series[4];
+	sampled.DecelerationNormal = series[5];
+	sampled.FrontDecelerationNormal = series[8];
+	const Common::EigenValuesElements::UpperLower* const upperLowers[] = {
+		driverEigen->PedalChange->T->AccelToBrake, driverEigen->PedalChange->T->BrakeToAccel
+		, driverEigen->PedalChange->V->AccelToBrake, driverEigen->PedalChange->V->BrakeToAccel
+		, driverEigen->TMargin->V, driverEigen->TMargin->T
+	};
+	for (const Common::EigenValuesElements::UpperLower* const ul : upperLowers) {
+		if (!ReadShared(is, ul->Upper) || !ReadShared(is, ul->Lower)) {
+			return false;
+		}
+	}
+	if (!ReadShared(is, driverEigen->V->Cruise) || !ReadShared(is, driverEigen->V->DeltaAtCruise->Plus) || !ReadShared(is, driverEigen->V->DeltaAtCruise->Minus)
+		|| !ReadShared(is, driverEigen->V->DeltaAt0->Plus) || !ReadShared(is, driverEigen->V->DeltaAt0->Minus)
+		|| !ReadShared(is, driverEigen->G->Closest) || !ReadShared(is, driverEigen->G->Cruise) || !ReadShared(is, driverEigen->G->Influenced)) {
+		return false;
+	}
+
+	DriverElements::MomentValues* const driverMoment = driver->Moment;
+	DriverElements::MomentValuesElements::PedalInformations* const pedal = driverMoment->pedal;
+	BinaryIO::Read(is, driverMoment->a);
+	BinaryIO::Read(is, driverMoment->recognitionHit);
+	BinaryIO::Read(is, driverMoment->R->velocity);
+	BinaryIO::Read(is, driverMoment->R->gap);
+	BinaryIO::Read(is, pedal->needTime);
+	BinaryIO::Read(is, pedal->timeElapsed);
+	BinaryIO::Read(is, pedal->changing);
+	BinaryIO::Read(is, pedal->footPosition);
+	BinaryIO::Read(is, pedal->targetFootPosition);
+	BinaryIO::Read(is, pedal->t->accelToBrake);
+	BinaryIO::Read(is, pedal->t->brakeToAccel);
+	BinaryIO::Read(is, driverMoment->v->target);
+	BinaryIO::Read(is, driverMoment->v->delta->plus);
+	BinaryIO::Read(is, driverMoment->v->delta->minus);
+	BinaryIO::Read(is, driverMoment->v->deltaV->current);
+	BinaryIO::Read(is, driverMoment->v->deltaV->last);
+	BinaryIO::Read(is, driverMoment->g->baseFg);
+	BinaryIO::Read(is, driverMoment->g->baseNg);
+	return BinaryIO::Read(is, driverMoment->g->emergency);
+}
@@ -0,0 +1,31 @@
+/*
+	This is header file of the class of "ModelStateClass" that writes the state of all cars, drivers and the random number generator to a binary stream and restores it.
+	The state is taken at the boundary of time steps, so that the reference informations of all cars are equal to their current values.
+	The eigenvalues shared by all cars and drivers are written with each car and checked against the current profile on Read, so a state of another profile is not restored.
+	A state that cannot be restored leaves the model as it was.
+	This inherits from "ModelBaseClass".
+*/
+
+#ifndef MODELSTATECLASS_H
+#define MODELSTATECLASS_H
+#include <iostream>
+#include <sstream>
+#include "BinaryIOPackage.h"
+#include "ModelBaseClass.h"
+
+class ModelStateClass : public ModelBaseClass {
+public:
+	ModelStateClass(const ModelBaseClass* const baseClass);	//constructor
+	~ModelStateClass();	//destructor
+
+	void Write(std::ostream& os) const;	//Write the state of all cars, drivers and the random number generator.
+	bool Read(std::istream& is) const;	//Restore the state written by "Write". If the stream is broken or written for another N or profile, return false and keep the current state.
+private:
+	bool Restore(std::istream& is) const;
+	void WriteCar(std::ostream& os, const CarStruct* const car) const;
+	bool ReadCar(std::istream& is, CarStruct* const car, std::size_t& rearID, std::size_t& frontID) const;
+	void WriteDriver(std::ostream& os, const DriverStruct* const driver) const;
+	bool ReadDriver(std::istream& is, DriverStruct* const driver) const;
+};
+
+#endif // !MODELSTATECLASS_H
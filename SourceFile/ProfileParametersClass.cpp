@@ -0,0 +1,122 @@
+/*
+	This is cpp file of the class of "ProfileParametersClass" that reads the car and driver-specific information from the ".ini" file once, and provides it as the profiles of the cars and the drivers.
+*/
+
+#include "ProfileParametersClass.h"
+
+/*
+	Draw a value. No random number is used in the "equal" mode.
+*/
+double ProfileParametersClass::SamplingSpec::Sample(const Random& random) const {
+	if (IsRandom) {
+		return random(Min, Max);
+	}
+	return Value;
+}
+
+/*
+	Initialize the profiles reading ".ini" file.
+*/
+ProfileParametersClass::ProfileParametersClass(const std::string& iniFilePath)
+	: carEigen(new CarElements::EigenValues())
+	, driverEigen(new DriverElements::EigenValues()) {
+	InitializeProperties(this);
+	ReadIniFilePackage ReadIniFile = ReadIniFilePackage(iniFilePath);
+	std::string sModeType;
+
+	//Car
+	carEigen->Vmax = Calculate_Km_h_To_m_s(ReadIniFile.ReadIni("Car Informations", "Vmax"));
+	carEigen->Amax->Plus = Calculate_Km_h_To_m_s(ReadIniFile.ReadIni("Car Informations", "A^+_max_V")) / ReadIniFile.ReadIni("Car Informations", "A^+_max_s");
+	carEigen->Amax->Minus = std::pow(Calculate_Km_h_To_m_s(ReadIniFile.ReadIni("Car Informations", "A^-_max_V")), 2) / 2 / ReadIniFile.ReadIni("Car Informations", "A^-_max_D");
+	carEigen->AResistance = Calculate_Km_h_To_m_s(ReadIniFile.ReadIni("Car Informations", "A^-_resistence"));
+	carEigen->Length = ReadIniFile.ReadIni("Car Informations", "Length");
+	ReadIniFile.ReadIni("Car Informations", "Driver", sModeType, ReadIniFilePackage::TransformModeType::Lower);
+	if (sModeType == "auto") {
+		carEigen->DriverMode = DriverModeType::Auto;
+	}
+	else {
+		carEigen->DriverMode = DriverModeType::Human;
+	}
+
+	//Driver
+	driverEigen->DecelerationAcceptable = ReadIniFile.ReadIni("Driver Informations::A", "A^-_acceptable");
+	_driver.AccelerationAcceptableV = Calculate_Km_h_To_m_s(ReadIniFile.ReadIni("Driver Informations::A", "A^+_acceptable_V"));
+	_driver.AccelerationAcceptableS = ReadSamplingSpec(ReadIniFile, "Driver Informations::A", "A^+_acceptable_mode", "A^+_acceptable_s", "A^+_acceptable_s^+", "A^+_acceptable_s^-");
+	_driver.DecelerationStrong = ReadSamplingSpec(ReadIniFile, "Driver Informations::A", "A^-_strong_mode", "A^-_strong", "A^-_strong^+", "A^-_strong^-");
+	_driver.DecelerationNormal = ReadSamplingSpec(ReadIniFile, "Driver Informations::A", "A^-_normal_mode", "A^-_normal", "A^-_normal^+", "A^-_normal^-");
+	_driver.FrontDecelerationNormal = ReadSamplingSpec(ReadIniFile, "Driver Informations::A", "A^-_Fnormal_mode", "A^-_Fnormal", "A^-_Fnormal^+", "A^-_Fnormal^-");
+	_driver.Fg = ReadSamplingSpec(ReadIniFile, "Driver Informations::Fg", "Fg_mode", "randomValue", "randomValue^+", "randomValue^-");
+
+	DriverElements::EigenValuesElements::VSerise* const V = driverEigen->V;
+	V->Cruise = Calculate_Km_h_To_m_s(ReadIniFile.ReadIni("Driver Informations::V", "V_cruise"));
+	V->DeltaAtCruise->Plus = Calculate_Km_h_To_m_s(ReadIniFile.ReadIni("Driver Informations::V", "deltaV^+_cruise"));
+	V->DeltaAtCruise->Minus = Calculate_Km_h_To_m_s(ReadIniFile.ReadIni("Driver Informations::V", "deltaV^-_cruise"));
+	V->DeltaAt0->Plus = Calculate_Km_h_To_m_s(ReadIniFile.ReadIni("Driver Informations::V", "deltaV^+_0"));
+	V->DeltaAt0->Minus = Calculate_Km_h_To_m_s(ReadIniFile.ReadIni("Driver Informations::V", "deltaV^-_0"));
+
+	DriverElements::EigenValuesElements::PedalChangingTimeInformations* const PedalChange = driverEigen->PedalChange;
+	PedalChange->V->AccelToBrake->Upper = Calculate_Km_h_To_m_s(ReadIniFile.ReadIni("Driver Informations::Pedal Change", "V^+_ab"));
+	PedalChange->V->AccelToBrake->Lower = Calculate_Km_h_To_m_s(ReadIniFile.ReadIni("Driver Informations::Pedal Change", "V^-_ab"));
+	PedalChange->T->AccelToBrake->Upper = ReadIniFile.ReadIni("Driver Informations::Pedal Change", "T^+_ab");
+	PedalChange->T->AccelToBrake->Lower = ReadIniFile.ReadIni("Driver Informations::Pedal Change", "T^-_ab");
+	PedalChange->V->BrakeToAccel->Upper = Calculate_Km_h_To_m_s(ReadIniFile.ReadIni("Driver Informations::Pedal Change", "V^+_ba"));
+	PedalChange->V->BrakeToAccel->Lower = Calculate_Km_h_To_m_s(ReadIniFile.ReadIni("Driver Informations::Pedal Change", "V^-_ba"));
+	PedalChange->T->BrakeToAccel->Upper = ReadIniFile.ReadIni("Driver Informations::Pedal Change", "T^+_ba");
+	PedalChange->T->BrakeToAccel->Lower = ReadIniFile.ReadIni("Driver Informations::Pedal Change", "T^-_ba");
+
+	DriverElements::EigenValuesElements::TMargin* const TMargin = driverEigen->TMargin;
+	TMargin->V->Upper = Calculate_Km_h_To_m_s(ReadIniFile.ReadIni("Driver Informations::Margin", "V^+_margin"));
+	TMargin->V->Lower = Calculate_Km_h_To_m_s(ReadIniFile.ReadIni("Driver Informations::Margin", "V^-_margin"));
+	TMargin->T->Upper = ReadIniFile.ReadIni("Driver Informations::Margin", "T^+_margin");
+	TMargin->T->Lower = ReadIniFile.ReadIni("Driver Informations::Margin", "T^-_margin");
+
+	Common::EigenValuesElements::GSerise* const G = driverEigen->G;
+	G->Closest = ReadIniFile.ReadIni("Driver Informations::G", "G_closest");
+	G->Cruise = ReadIniFile.ReadIni("Driver Informations::G", "G_cruise");
+	G->Influenced = ReadIniFile.ReadIni("Driver Informations::G", "G_influenced");
+}
+
+//destructor
+ProfileParametersClass::~ProfileParametersClass() {
+	SafeDelete(carEigen);	//delete CarElements::EigenValues
+	SafeDelete(driverEigen);	//delete DriverElements::EigenValues
+}
+
+/*
+	"equal" mode reads "ValueName", and the others read "PlusName" and "MinusName".
+*/
+ProfileParametersClass::SamplingSpec ProfileParametersClass::ReadSamplingSpec(ReadIniFilePackage& ReadIniFile, const std::string& SectionName, const std::string& ModeName, const std::string& ValueName, const std::string& PlusName, const std::string& MinusName) {
+	SamplingSpec spec;
+	std::string sModeType;
+	ReadIniFile.ReadIni(SectionName, ModeName, sModeType, ReadIniFilePackage::TransformModeType::Lower);
+	spec.IsRandom = sModeType != "equal";
+	spec.Value = 0;
+	spec.Min = 0;
+	spec.Max = 0;
+	if (spec.IsRandom) {
+		spec.Max = ReadIniFile.ReadIni(SectionName, PlusName);
+		spec.Min = ReadIniFile.ReadIni(SectionName, MinusName);
+	}
+	else {
+		spec.Value = ReadIniFile.ReadIni(SectionName, ValueName);
+	}
+	return spec;
+}
+
+void ProfileParametersClass::InitializeProperties(ProfileParametersClass* const thisPtr) {
+	CarEigen(std::bind(&ProfileParametersClass::Get_CarEigen, thisPtr));
+	DriverEigen(std::bind(&ProfileParametersClass::Get_DriverEigen, thisPtr));
+	Driver(std::bind(&ProfileParametersClass::Get_Driver, thisPtr));
+}
+
+const CarElements::EigenValues* ProfileParametersClass::Get_CarEigen() const {
+	return carEigen;
+}
+
+const DriverElements::EigenValues* ProfileParametersClass::Get_DriverEigen() const {
+	return driverEigen;
+}
+
+const ProfileParametersClass::DriverProfile& ProfileParametersClass::Get_Driver() const {
+	return _driver;
+}
@@ -0,0 +1,57 @@
+/*
+	This is header file of the class of "ProfileParametersClass" that reads the car and driver-specific information from the ".ini" file once, and provides it as the profiles of the cars and the drivers.
+	The values of the ".ini" file are converted to the units of the model here, so that "InitializerClass" only draws the random numbers for each car.
+	The eigenvalues that are the same for all cars and drivers are built here once, and every car and driver refers to them instead of owning a copy.
+	A value of "DriverProfile" is either the same for all drivers ("equal" mode), or drawn uniformly from [min, max] for each driver, and is stored in each driver.
+*/
+
+#ifndef PROFILEPARAMETERSCLASS_H
+#define PROFILEPARAMETERSCLASS_H
+#include <cmath>
+#include "random.h"
+#include "CarStruct.h"
+#include "Common.h"
+#include "ReadIniFilePackage.h"
+#include "ReadOnlyPropertyClass.h"
+
+class ProfileParametersClass {
+public:
+	//A value of a driver that is fixed or drawn for each driver.
+	struct SamplingSpec {
+		bool IsRandom;	//false:"equal" mode
+		double Value;	//The value of the "equal" mode
+		double Min;
+		double Max;
+		double Sample(const Random& random) const;	//Draw a value. No random number is used in the "equal" mode.
+	};
+
+	//The values drawn for each driver
+	struct DriverProfile {
+		double AccelerationAcceptableV;	//m/s. The acceptable acceleration is this divided by "AccelerationAcceptableS".
+		SamplingSpec AccelerationAcceptableS;	//s
+		SamplingSpec DecelerationStrong;
+		SamplingSpec DecelerationNormal;
+		SamplingSpec FrontDecelerationNormal;
+		SamplingSpec Fg;	//The base of "Ng"
+	};
+
+	ProfileParametersClass(const std::string& iniFilePath);	//Initialize the profiles reading ".ini" file.
+	~ProfileParametersClass();	//destructor
+private:
+	CarElements::EigenValues* carEigen;
+	DriverElements::EigenValues* driverEigen;
+	DriverProfile _driver;
+
+	static SamplingSpec ReadSamplingSpec(ReadIniFilePackage& ReadIniFile, const std::string& SectionName, const std::string& ModeName, const std::string& ValueName, const std::string& PlusName, const std::string& MinusName);	//"equal" mode reads "ValueName", and the others read "PlusName" and "MinusName".
+	void InitializeProperties(ProfileParametersClass* const thisPtr);
+
+	const CarElements::EigenValues* Get_CarEigen() const;
+	const DriverElements::EigenValues* Get_DriverEigen() const;
+	const DriverProfile& Get_Driver() const;
+public:
+	ReadOnlyPropertyClass<const CarElements::EigenValues*> CarEigen;	//Shared by all cars
+	ReadOnlyPropertyClass<const DriverElements::EigenValues*> DriverEigen;	//Shared by all drivers
+	ReadOnlyPropertyClass<const DriverProfile&> Driver;
+};
+
+#endif // !PROFILEPARAMETERSCLASS_H
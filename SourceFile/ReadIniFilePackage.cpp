@@ -3,72 +3,70 @@
 */
 
 #include "ReadIniFilePackage.h"
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // !_WIN32
 
-char ReadIniFilePackage::ToUpper::operator()(const char& c) {
-	return std::toupper(c);
-}
+namespace {
+	bool IsSpace(const char& c) {
+		return std::isspace(static_cast<unsigned char>(c)) != 0;
+	}
 
+	char Upper(const char& c) {
+		return char(std::toupper(static_cast<unsigned char>(c)));
+	}
 
-char ReadIniFilePackage::ToLower::operator()(const char& c) {
-	return std::tolower(c);
-}
+	//The token read by "operator>>" of "std::istream"
+	void Token(const char*& p, std::size_t& length) {
+		const char* const end = p + length;
+		while (p < end && IsSpace(*p)) {
+			p++;
+		}
+		const char* q = p;
+		while (q < end && !IsSpace(*q)) {
+			q++;
+		}
+		length = std::size_t(q - p);
+	}
 
-bool ReadIniFilePackage::IsSpace::operator()(const char& c) {
-	return (c == ' ');
+	std::size_t Digits(const char* const p, const std::size_t& i, const std::size_t& length) {
+		std::size_t j = i;
+		while (j < length && std::isdigit(static_cast<unsigned char>(p[j])) != 0) {
+			j++;
+		}
+		return j - i;
+	}
 }
 
-ReadIniFilePackage::SectionVariable::SectionVariable(const std::string& section, const std::string& variable) {
-	this->section = section;
-	this->variable = variable;
-	std::transform(this->section.begin(), this->section.end(), this->section.begin(), ToUpper());
-	std::transform(this->variable.begin(), this->variable.end(), this->variable.begin(), ToUpper());
+char ReadIniFilePackage::ToUpper::operator()(const char& c) {
+	return std::toupper(c);
 }
 
-bool ReadIniFilePackage::SectionVariable::operator<(const SectionVariable& val) const {
-	if (this->section < val.section) {
-		return true;
-	}
-	else {
-		if (this->section > val.section) {
-			return false;
-		}
-		else {
-			if (this->variable < val.variable) {
-				return true;
-			}
-			else {
-				return false;
-			}
-		}
-	}
+
+char ReadIniFilePackage::ToLower::operator()(const char& c) {
+	return std::tolower(c);
 }
 
 ReadIniFilePackage::ReadIniFilePackage(const std::string& FileName) {
-	datas = new std::vector<std::string*>;
-	locations = new std::map<SectionVariable, int>;
+	mask = 0;
 	ReadAllData(FileName);
 }
 
-ReadIniFilePackage::~ReadIniFilePackage() {
-	for (std::size_t i = 0; i < datas->size(); i++) {
-		delete (*datas)[i];
-	}
-	delete datas;
-	delete locations;
-}
+ReadIniFilePackage::~ReadIniFilePackage() { }
 
 double ReadIniFilePackage::ReadIni(const std::string& SectionName, const std::string& VariableName) {
-	double val;
-	GetData(SectionName, VariableName, val);
-	return val;
+	return GetEntry(SectionName, VariableName).number;
 }
 
 void ReadIniFilePackage::ReadIni(const std::string& SectionName, const std::string& VariableName, int& val) {
-	GetData(SectionName, VariableName, val);
+	val = GetEntry(SectionName, VariableName).integer;
 }
 
 void ReadIniFilePackage::ReadIni(const std::string& SectionName, const std::string& VariableName, double& val) {
-	GetData(SectionName, VariableName, val);
+	val = GetEntry(SectionName, VariableName).number;
 }
 
 void ReadIniFilePackage::ReadIni(const std::string& SectionName, const std::string& VariableName, std::string& val) {
@@ -76,7 +74,11 @@ void ReadIniFilePackage::ReadIni(const std::string& SectionName, const std::stri
 }
 
 void ReadIniFilePackage::ReadIni(const std::string& SectionName, const std::string& VariableName, std::string& val, const TransformModeType& transformMode) {
-	GetData(SectionName, VariableName, val);
+	const Entry& entry = GetEntry(SectionName, VariableName);
+	const char* p = values.data() + entry.valueOffset;
+	std::size_t length = entry.valueLength;
+	Token(p, length);
+	val.assign(p, length);
 	switch (transformMode) {
 	case TransformModeType::Upper:
 		std::transform(val.begin(), val.end(), val.begin(), ToUpper());
@@ -89,51 +91,220 @@ void ReadIniFilePackage::ReadIni(const std::string& SectionName, const std::stri
 	}
 }
 
+/*
+	Map the file to the memory and parse it. The mapping is released after the values are copied.
+*/
 void ReadIniFilePackage::ReadAllData(const std::string& FileName) {
-	std::ifstream ifs(FileName);
+#ifndef _WIN32
+	const int&& fd = open(FileName.c_str(), O_RDONLY);
+	struct stat st;
+	if (fd < 0 || fstat(fd, &st) != 0 || !S_ISREG(st.st_mode)) {
+		if (fd >= 0) {
+			close(fd);
+		}
+		throw std::invalid_argument("Not File Existants:" + FileName);
+	}
+	const std::size_t&& size = std::size_t(st.st_size);
+	if (size > 0) {
+		void* const mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (mapped == MAP_FAILED) {
+			close(fd);
+			throw std::invalid_argument("Not File Existants:" + FileName);
+		}
+		Parse(static_cast<const char*>(mapped), size);
+		munmap(mapped, size);
+	}
+	close(fd);
+#else
+	std::ifstream ifs(FileName, std::ios::binary);
 	if (!ifs) {
 		throw std::invalid_argument("Not File Existants:" + FileName);
-		return;
 	}
-	std::string section;
-	std::string variable;
-	std::string S;
-	int i = 0;
-	std::size_t ifind;
-	while (std::getline(ifs, S)) {
-		if (S != "") {
-			if (S[0] == '[' && S[S.size() - 1] == ']') {
-				section = S.substr(1, S.size() - 2);
+	const std::string data((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+	Parse(data.data(), data.size());
+#endif // !_WIN32
+	BuildTable();
+}
+
+/*
+	A line is "[section]" or "variable=value #comment". The spaces are removed from the value.
+	The names are used as they are written except the case.
+*/
+void ReadIniFilePackage::Parse(const char* const data, const std::size_t& size) {
+	const char* section = data;
+	std::size_t sectionLength = 0;
+	std::string value;
+	const char* const end = data + size;
+	for (const char* line = data; line < end;) {
+		const char* lineEnd = std::find(line, end, '\n');
+		const char* const next = lineEnd == end ? end : lineEnd + 1;
+		if (lineEnd > line && lineEnd[-1] == '\r') {
+			lineEnd--;
+		}
+		if (lineEnd > line) {
+			if (line[0] == '[' && lineEnd[-1] == ']' && lineEnd - line >= 2) {
+				section = line + 1;
+				sectionLength = std::size_t(lineEnd - line - 2);
 			}
 			else {
-				ifind = S.find_first_of('=');
-				if (ifind != std::string::npos) {
-					variable = S.substr(0, ifind);
-					S = S.substr(ifind + 1);
-					S.erase(std::remove_if(S.begin(), S.end(), IsSpace()), S.end());
-					S = S.substr(0, S.find_first_of('#'));
-					if (S.size() > 0) {
-						datas->emplace_back(new std::string(S));
-						(*locations)[SectionVariable(section, variable)] = i;
-						i++;
+				const char* const equal = std::find(line, lineEnd, '=');
+				if (equal != lineEnd) {
+					value.clear();
+					for (const char* p = equal + 1; p < lineEnd && *p != '#'; p++) {
+						if (*p != ' ') {
+							value += *p;
+						}
+					}
+					if (!value.empty()) {
+						AddEntry(section, sectionLength, line, std::size_t(equal - line), value.data(), value.size());
 					}
 				}
 			}
 		}
+		line = next;
+	}
+}
+
+void ReadIniFilePackage::AddEntry(const char* const section, const std::size_t& sectionLength, const char* const variable, const std::size_t& variableLength, const char* const value, const std::size_t& valueLength) {
+	Entry entry;
+	entry.hash = Hash(section, sectionLength, variable, variableLength);
+	entry.keyOffset = keys.size();
+	entry.sectionLength = sectionLength;
+	entry.variableLength = variableLength;
+	for (std::size_t i = 0; i < sectionLength; i++) {
+		keys += Upper(section[i]);
+	}
+	keys += '\0';
+	for (std::size_t i = 0; i < variableLength; i++) {
+		keys += Upper(variable[i]);
+	}
+	entry.valueOffset = values.size();
+	entry.valueLength = valueLength;
+	values.append(value, valueLength);
+	ParseNumbers(value, valueLength, entry.number, entry.integer);
+	entries.emplace_back(entry);
+}
+
+/*
+	The later value of the same names is used.
+*/
+void ReadIniFilePackage::BuildTable() {
+	std::size_t size = 16;
+	while (size < entries.size() * 2) {
+		size <<= 1;
+	}
+	table.assign(size, 0);
+	mask = size - 1;
+	for (std::size_t i = 0; i < entries.size(); i++) {
+		const Entry& entry = entries[i];
+		for (std::size_t slot = std::size_t(entry.hash) & mask;; slot = (slot + 1) & mask) {
+			if (table[slot] == 0) {
+				table[slot] = i + 1;
+				break;
+			}
+			const Entry& other = entries[table[slot] - 1];
+			if (other.hash == entry.hash && other.sectionLength == entry.sectionLength && other.variableLength == entry.variableLength
+				&& keys.compare(other.keyOffset, other.sectionLength + 1 + other.variableLength, keys, entry.keyOffset, entry.sectionLength + 1 + entry.variableLength) == 0) {
+				table[slot] = i + 1;
+				break;
+			}
+		}
 	}
-	ifs.close();
 }
 
-template<typename _T>
-void ReadIniFilePackage::GetData(const std::string& SectionName, const std::string& VariableName, _T& val) const {
-	const SectionVariable SV(SectionName, VariableName);
-	std::map<SectionVariable, int>::iterator i = locations->find(SV);
-	if (i == locations->end()) {
+/*
+	nullptr if there is no value.
+*/
+const ReadIniFilePackage::Entry* ReadIniFilePackage::Find(const std::string& SectionName, const std::string& VariableName) const {
+	if (table.empty()) {
+		return nullptr;
+	}
+	const std::uint64_t&& hash = Hash(SectionName.data(), SectionName.size(), VariableName.data(), VariableName.size());
+	for (std::size_t slot = std::size_t(hash) & mask; table[slot] != 0; slot = (slot + 1) & mask) {
+		const Entry& entry = entries[table[slot] - 1];
+		if (entry.hash == hash && Matches(entry, SectionName, VariableName)) {
+			return &entry;
+		}
+	}
+	return nullptr;
+}
+
+const ReadIniFilePackage::Entry& ReadIniFilePackage::GetEntry(const std::string& SectionName, const std::string& VariableName) const {
+	const Entry* const entry = Find(SectionName, VariableName);
+	if (entry == nullptr) {
 		throw std::invalid_argument("Not Found SectionName:" + SectionName + " VariableName:" + VariableName);
 	}
-	else {
-		std::stringstream SS;
-		SS << *(*datas)[(*locations)[SV]];
-		SS >> val;
+	return *entry;
+}
+
+bool ReadIniFilePackage::Matches(const Entry& entry, const std::string& SectionName, const std::string& VariableName) const {
+	if (entry.sectionLength != SectionName.size() || entry.variableLength != VariableName.size()) {
+		return false;
+	}
+	const char* const section = keys.data() + entry.keyOffset;
+	const char* const variable = section + entry.sectionLength + 1;
+	for (std::size_t i = 0; i < SectionName.size(); i++) {
+		if (section[i] != Upper(SectionName[i])) {
+			return false;
+		}
+	}
+	for (std::size_t i = 0; i < VariableName.size(); i++) {
+		if (variable[i] != Upper(VariableName[i])) {
+			return false;
+		}
+	}
+	return true;
+}
+
+/*
+	The names are hashed as the upper case by FNV-1a.
+*/
+std::uint64_t ReadIniFilePackage::Hash(const char* const section, const std::size_t& sectionLength, const char* const variable, const std::size_t& variableLength) {
+	std::uint64_t hash = 14695981039346656037ULL;
+	for (std::size_t i = 0; i < sectionLength; i++) {
+		hash = (hash ^ std::uint8_t(Upper(section[i]))) * 1099511628211ULL;
+	}
+	hash = (hash ^ 0xFF) * 1099511628211ULL;	//The separator is not a character of the names.
+	for (std::size_t i = 0; i < variableLength; i++) {
+		hash = (hash ^ std::uint8_t(Upper(variable[i]))) * 1099511628211ULL;
+	}
+	return hash ^ (hash >> 32);
+}
+
+/*
+	Read the numbers as "std::istream" does. The longest prefix of the token in the decimal form is read, and 0 if there is none or the exponent is broken.
+*/
+void ReadIniFilePackage::ParseNumbers(const char* const value, const std::size_t& valueLength, double& number, int& integer) {
+	const char* p = value;
+	std::size_t length = valueLength;
+	Token(p, length);
+	number = 0;
+	integer = 0;
+	std::size_t i = (length > 0 && (p[0] == '+' || p[0] == '-')) ? 1 : 0;
+	const std::size_t&& integerDigits = Digits(p, i, length);
+	if (integerDigits > 0) {
+		const long long&& val = std::strtoll(std::string(p, i + integerDigits).c_str(), nullptr, 10);
+		integer = int((std::max)((std::min)(val, (long long)INT_MAX), (long long)INT_MIN));
+	}
+	i += integerDigits;
+	std::size_t fractionDigits = 0;
+	if (i < length && p[i] == '.') {
+		fractionDigits = Digits(p, i + 1, length);
+		i += 1 + fractionDigits;
 	}
-}
\ No newline at end of file
+	if (integerDigits + fractionDigits == 0) {
+		return;
+	}
+	if (i < length && (p[i] == 'e' || p[i] == 'E')) {
+		std::size_t j = i + 1;
+		if (j < length && (p[j] == '+' || p[j] == '-')) {
+			j++;
+		}
+		const std::size_t&& exponentDigits = Digits(p, j, length);
+		if (exponentDigits == 0) {
+			return;	//"std::istream" fails when the exponent has no digits.
+		}
+		i = j + exponentDigits;
+	}
+	number = std::strtod(std::string(p, i).c_str(), nullptr);
+}
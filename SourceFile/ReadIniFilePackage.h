@@ -1,15 +1,20 @@
 /*
 	This is header file of the class of "ReadIniFilePackage" that a class for reading ".ini" files.
+	The file is mapped to the memory (read at once on Windows) and parsed in place. Only the values are copied, into a single buffer.
+	The section and variable names are normalized to the upper case once when the file is loaded, and indexed by an open addressing hash table,
+	so a lookup neither copies nor transforms the names. The numbers are parsed once when the file is loaded.
 */
 
 #ifndef READINIFILEPACKAGE_H
 #define READINIFILEPACKAGE_H
 #include <algorithm>
 #include <cctype>
+#include <climits>
+#include <cstdint>
+#include <cstdlib>
 #include <exception>
 #include <fstream>
-#include <map>
-#include <sstream>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -35,22 +40,34 @@ private:
 	struct ToLower {
 		char operator()(const char& c);
 	};
-	struct IsSpace	{
-		bool operator()(const char& c);
-	};
-	class SectionVariable {
-	public:
-		std::string section;
-		std::string variable;
-		SectionVariable(const std::string& section, const std::string& variable);
-		bool operator<(const SectionVariable& val) const;
+
+	//A value of the file
+	struct Entry {
+		std::uint64_t hash;
+		std::size_t keyOffset;	//"SECTION" + '\0' + "VARIABLE" in "keys"
+		std::size_t sectionLength;
+		std::size_t variableLength;
+		std::size_t valueOffset;	//in "values"
+		std::size_t valueLength;
+		double number;	//The value read as a double
+		int integer;	//The value read as an int
 	};
-	std::vector<std::string*>* datas;
-	std::map<SectionVariable, int>* locations;
+	std::string keys;
+	std::string values;
+	std::vector<Entry> entries;
+	std::vector<std::size_t> table;	//The index of "entries" + 1. 0 is empty.
+	std::size_t mask;
+
 	void ReadAllData(const std::string& FileName);
+	void Parse(const char* const data, const std::size_t& size);
+	void AddEntry(const char* const section, const std::size_t& sectionLength, const char* const variable, const std::size_t& variableLength, const char* const value, const std::size_t& valueLength);
+	void BuildTable();	//The later value of the same names is used.
+	const Entry* Find(const std::string& SectionName, const std::string& VariableName) const;	//nullptr if there is no value.
+	const Entry& GetEntry(const std::string& SectionName, const std::string& VariableName) const;
+	bool Matches(const Entry& entry, const std::string& SectionName, const std::string& VariableName) const;
 
-	template<typename _T>
-	void GetData(const std::string& SectionName, const std::string& VariableName, _T& val) const;
+	static std::uint64_t Hash(const char* const section, const std::size_t& sectionLength, const char* const variable, const std::size_t& variableLength);	//The names are hashed as the upper case.
+	static void ParseNumbers(const char* const value, const std::size_t& valueLength, double& number, int& integer);	//Read the numbers as "std::istream" does.
 };
 
 #endif // !READINIFILEPACKAGE_H
@@ -0,0 +1,56 @@
+/*
+	This is cpp file of the class of "ResultCachePackage" that saves the results of each N to a binary cache file and loads them, so that the same simulation is not repeated.
+*/
+
+#include "ResultCachePackage.h"
+
+//constructor
+ResultCachePackage::ResultCachePackage(const std::string& FolderPath, const double& MaxSizeMB, const std::string& ModelIniFilePath, const std::string& DriverIniFilePath, const std::string& StatisticsIniFilePath, const int& RetryMaxAttempts)
+	: Folder(FolderPath, MaxSizeMB, "CTFMRSC1", ".rsc") {
+	HashPackage hash;
+	hash.Add(std::uint32_t(CodeVersion));
+	hash.AddIniFile(ModelIniFilePath);
+	hash.AddIniFile(DriverIniFilePath);
+	hash.AddIniFile(StatisticsIniFilePath, { "SnapShot" });	//The snapshots do not change the results.
+	hash.Add(std::int32_t(RetryMaxAttempts));
+	configHash = hash.Value();
+}
+
+//destructor
+ResultCachePackage::~ResultCachePackage() { }
+
+std::string ResultCachePackage::CreateKey(const int& N, const unsigned int& Seed) const {
+	HashPackage hash;
+	hash.Add(configHash);
+	hash.Add(std::int32_t(N));
+	hash.Add(std::uint32_t(Seed));
+	return hash.Hex();
+}
+
+/*
+	If there is no entry, return false.
+*/
+bool ResultCachePackage::Load(const std::string& key, Result& result) const {
+	std::string payload;
+	if (!Folder.Load(key, payload)) {
+		return false;
+	}
+	std::stringstream SS(payload);
+	return BinaryIO::ReadString(SS, result.FD) && BinaryIO::ReadString(SS, result.GlobalVD) && BinaryIO::ReadString(SS, result.LocalVD)
+		&& BinaryIO::Read(SS, result.V) && BinaryIO::Read(SS, result.LocalStandardDeviation) && BinaryIO::Read(SS, result.Seed) && BinaryIO::Read(SS, result.Attempts);
+}
+
+/*
+	Save the results as the entry, and remove the old entries if the cache is too large.
+*/
+void ResultCachePackage::Store(const std::string& key, const Result& result) {
+	std::stringstream SS;
+	BinaryIO::WriteString(SS, result.FD);
+	BinaryIO::WriteString(SS, result.GlobalVD);
+	BinaryIO::WriteString(SS, result.LocalVD);
+	BinaryIO::Write(SS, result.V);
+	BinaryIO::Write(SS, result.LocalStandardDeviation);
+	BinaryIO::Write(SS, result.Seed);
+	BinaryIO::Write(SS, result.Attempts);
+	Folder.Store(key, SS.str());
+}
@@ -0,0 +1,42 @@
+/*
+	This is header file of the class of "ResultCachePackage" that saves the results of each N to a binary cache file and loads them, so that the same simulation is not repeated.
+	Each entry is keyed by a hash of the values of the model ".ini" file, the driver ".ini" file and the statistics ".ini" file (without the snapshot), N, the seed, the number of the retries and the version of the code.
+	The values of the ".ini" files are hashed as they are read, so the comments and the spaces do not change the key.
+	The entries are kept by "CacheFolderPackage", which bounds the total size of the cache.
+*/
+
+#ifndef RESULTCACHEPACKAGE_H
+#define RESULTCACHEPACKAGE_H
+#include <sstream>
+#include <string>
+#include "BinaryIOPackage.h"
+#include "CacheFolderPackage.h"
+#include "HashPackage.h"
+
+class ResultCachePackage {
+public:
+	static const std::uint32_t CodeVersion = 1;	//Increase this when a change of the model changes the results, so that the old entries are not used.
+
+	//The results of an N
+	struct Result {
+		std::string FD;	//The lines of the result files
+		std::string GlobalVD;
+		std::string LocalVD;
+		double V;	//km/h
+		double LocalStandardDeviation;	//km/h
+		std::uint32_t Seed;	//The seed of the successful attempt
+		std::uint32_t Attempts;
+	};
+
+	ResultCachePackage(const std::string& FolderPath, const double& MaxSizeMB, const std::string& ModelIniFilePath, const std::string& DriverIniFilePath, const std::string& StatisticsIniFilePath, const int& RetryMaxAttempts);	//constructor
+	~ResultCachePackage();	//destructor
+
+	std::string CreateKey(const int& N, const unsigned int& Seed) const;
+	bool Load(const std::string& key, Result& result) const;	//If there is no entry, return false.
+	void Store(const std::string& key, const Result& result);	//Save the results as the entry, and remove the old entries if the cache is too large.
+private:
+	const CacheFolderPackage Folder;
+	std::uint64_t configHash;
+};
+
+#endif // !RESULTCACHEPACKAGE_H
@@ -0,0 +1,167 @@
+/*
+	This is cpp file of the class of "ResultWriterPackage" that writes the results of the simulations on an output thread.
+*/
+
+#include "ResultWriterPackage.h"
+
+//constructor
+ResultWriterPackage::ResultWriterPackage(const std::string& FDPath, const std::string& GlobalVDPath, const std::string& LocalVDPath, const std::string& FailureLogPath, const std::string& DetectorFDPath, const std::string& DetectorVDPath, const double& SyncInterval, ManifestPackage* const Manifest)
+	: FailureLogPath(FailureLogPath)
+	, DetectorFDPath(DetectorFDPath)
+	, DetectorVDPath(DetectorVDPath)
+	, SyncInterval(SyncInterval)
+	, Manifest(Manifest) {
+	fFD = std::fopen(FDPath.c_str(), "a");
+	fGlobalVD = std::fopen(GlobalVDPath.c_str(), "a");
+	fLocalVD = std::fopen(LocalVDPath.c_str(), "a");
+	fFailureLog = nullptr;
+	fDetectorFD = nullptr;
+	fDetectorVD = nullptr;
+	//The position of a file opened to append is not decided until it is written, so the offsets are taken from the end.
+	//The line torn by a crash is ended, so that the next line is not joined to it.
+	const std::string* const paths[] = { &FDPath, &GlobalVDPath, &LocalVDPath };
+	std::FILE* const files[] = { fFD, fGlobalVD, fLocalVD };
+	for (std::size_t i = 0; i < 3; i++) {
+		if (files[i] != nullptr) {
+			std::fseek(files[i], 0, SEEK_END);
+			if (!EndsWithNewLine(*paths[i])) {
+				std::fputc('\n', files[i]);
+			}
+		}
+	}
+	pending.store(false);
+	stopping.store(false);
+	outputThread = std::thread(&ResultWriterPackage::RunOutputThread, this);
+}
+
+//destructor
+ResultWriterPackage::~ResultWriterPackage() {
+	stopping.store(true);
+	wake.notify_one();
+	outputThread.join();
+	std::FILE* const files[] = { fFD, fGlobalVD, fLocalVD, fFailureLog, fDetectorFD, fDetectorVD };
+	for (std::FILE* const file : files) {
+		if (file != nullptr) {
+			std::fclose(file);
+		}
+	}
+}
+
+/*
+	This can be called by the worker threads at the same time, and never blocks.
+	If the output thread is sleeping, it is woken. Even if the notification is missed, it wakes within its timeout.
+*/
+void ResultWriterPackage::Push(Record&& record) {
+	queue.Push(std::move(record));
+	pending.store(true);
+	wake.notify_one();
+}
+
+void ResultWriterPackage::RunOutputThread() {
+	std::chrono::steady_clock::time_point lastSync = std::chrono::steady_clock::now();
+	Record record;
+	while (true) {
+		//The records pushed before "stopping" are always written.
+		const bool&& stop = stopping.load();
+		pending.store(false);
+		bool written = false;
+		while (queue.Pop(record)) {
+			Write(record);
+			written = true;
+		}
+		const std::chrono::duration<double>&& sinceSync = std::chrono::steady_clock::now() - lastSync;
+		const bool&& toDisk = SyncInterval > 0 && (stop || sinceSync.count() >= SyncInterval);
+		if (written || toDisk) {
+			Sync(toDisk);
+			if (toDisk) {
+				lastSync = std::chrono::steady_clock::now();
+			}
+			for (const ManifestPackage::Entry& entry : flushing) {
+				Manifest->Write(entry);
+			}
+			flushing.clear();
+		}
+		if (stop) {
+			return;
+		}
+		std::unique_lock<std::mutex> lock(wakeMutex);
+		wake.wait_for(lock, std::chrono::milliseconds(100), [this] { return pending.load() || stopping.load(); });
+	}
+}
+
+void ResultWriterPackage::Write(Record& record) {
+	ManifestPackage::Entry& entry = record.Entry;
+	entry.FDSize = Append(fFD, record.FD, entry.FDOffset);
+	entry.GlobalVDSize = Append(fGlobalVD, record.GlobalVD, entry.GlobalVDOffset);
+	entry.LocalVDSize = Append(fLocalVD, record.LocalVD, entry.LocalVDOffset);
+	if (Manifest != nullptr && entry.N != 0) {
+		flushing.emplace_back(entry);
+	}
+	AppendLog(fFailureLog, FailureLogPath, "N,Seed,Attempt,Phase,MeasureN,Step,Time,CarNs\n", record.FailureLog);
+	AppendLog(fDetectorFD, DetectorFDPath, "N,Detector,k,Flux,MeasureN,IntervalN\n", record.DetectorFD);
+	AppendLog(fDetectorVD, DetectorVDPath, "N,Detector,k,V,MeasureN,IntervalN\n", record.DetectorVD);
+	if (!record.Console.empty()) {
+		std::cout << record.Console << std::flush;
+	}
+}
+
+/*
+	Flush the files, and write them to the disk if "toDisk" is true.
+*/
+void ResultWriterPackage::Sync(const bool& toDisk) {
+	std::FILE* const files[] = { fFD, fGlobalVD, fLocalVD, fFailureLog, fDetectorFD, fDetectorVD };
+	for (std::FILE* const file : files) {
+		if (file == nullptr) {
+			continue;
+		}
+		if (toDisk) {
+			FileSystem::SyncFile(file);
+		}
+		else {
+			std::fflush(file);
+		}
+	}
+}
+
+/*
+	Open the file when it is written for the first time, and write the header if it is new.
+	These files are not recorded in the manifest.
+*/
+void ResultWriterPackage::AppendLog(std::FILE*& file, const std::string& path, const std::string& header, const std::string& text) {
+	if (text.empty()) {
+		return;
+	}
+	std::uint64_t offset;
+	if (file == nullptr) {
+		const bool&& exists = FileSystem::Exists(path);
+		file = std::fopen(path.c_str(), "a");
+		if (!exists) {
+			Append(file, header, offset);
+		}
+	}
+	Append(file, text, offset);
+}
+
+/*
+	An empty file is regarded as ended.
+*/
+bool ResultWriterPackage::EndsWithNewLine(const std::string& path) {
+	std::ifstream ifs(path, std::ios::binary);
+	if (!ifs.seekg(-1, std::ios::end)) {
+		return true;
+	}
+	return ifs.get() == '\n';
+}
+
+/*
+	Return the bytes written, and set the offset where they were written.
+*/
+std::uint32_t ResultWriterPackage::Append(std::FILE* file, const std::string& text, std::uint64_t& offset) {
+	offset = 0;
+	if (file == nullptr || text.empty()) {
+		return 0;
+	}
+	const long&& position = std::ftell(file);
+	offset = position < 0 ? 0 : std::uint64_t(position);
+	return std::uint32_t(std::fwrite(text.data(), 1, text.size(), file));
+}
@@ -0,0 +1,72 @@
+/*
+	This is header file of the class of "ResultWriterPackage" that writes the results of the simulations on an output thread.
+	The worker threads push the results of each N to a lock-free queue, and never wait for the disk or for each other.
+	The output thread keeps the result files open, appends the results to them and flushes them after each batch.
+	The files are also written to the disk by fsync at the configured interval and when the writer is deleted.
+	The records of the manifest are written after the lines of the same N have been flushed, so an N is never "Done" without its results.
+*/
+
+#ifndef RESULTWRITERPACKAGE_H
+#define RESULTWRITERPACKAGE_H
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "FileSystemPackage.h"
+#include "ManifestPackage.h"
+#include "MPSCQueuePackage.h"
+
+class ResultWriterPackage {
+public:
+	//The lines of the result files and the console for a finished N. The empty ones are not written.
+	struct Record {
+		std::string FD;
+		std::string GlobalVD;
+		std::string LocalVD;
+		std::string FailureLog;
+		std::string DetectorFD;
+		std::string DetectorVD;
+		std::string Console;
+		ManifestPackage::Entry Entry;	//The offsets and the bytes of the lines are set by the writer. It is not written if N is 0.
+	};
+
+	ResultWriterPackage(const std::string& FDPath, const std::string& GlobalVDPath, const std::string& LocalVDPath, const std::string& FailureLogPath, const std::string& DetectorFDPath, const std::string& DetectorVDPath, const double& SyncInterval, ManifestPackage* const Manifest);	//constructor. "Manifest" can be nullptr.
+	~ResultWriterPackage();	//destructor. Write all records in the queue, and close the files.
+
+	void Push(Record&& record);	//This can be called by the worker threads at the same time, and never blocks.
+private:
+	const std::string FailureLogPath;
+	const std::string DetectorFDPath;
+	const std::string DetectorVDPath;
+	const double SyncInterval;	//s (wall-clock time). 0 means no fsync.
+	std::FILE* fFD;
+	std::FILE* fGlobalVD;
+	std::FILE* fLocalVD;
+	std::FILE* fFailureLog;	//Opened when the first failure is written.
+	std::FILE* fDetectorFD;	//Opened when the first result of the detectors is written.
+	std::FILE* fDetectorVD;
+	ManifestPackage* const Manifest;
+	std::vector<ManifestPackage::Entry> flushing;	//The records of the manifest written after the next flush
+
+	MPSCQueuePackage<Record> queue;
+	std::atomic<bool> pending;
+	std::atomic<bool> stopping;
+	std::mutex wakeMutex;	//Only the output thread waits with this.
+	std::condition_variable wake;
+	std::thread outputThread;
+
+	void RunOutputThread();
+	void Write(Record& record);
+	void Sync(const bool& toDisk);
+	static void AppendLog(std::FILE*& file, const std::string& path, const std::string& header, const std::string& text);	//Open the file when it is written for the first time, and write the header if it is new.
+	static bool EndsWithNewLine(const std::string& path);	//An empty file is regarded as ended.
+	static std::uint32_t Append(std::FILE* file, const std::string& text, std::uint64_t& offset);	//Return the bytes written, and set the offset where they were written.
+};
+
+#endif // !RESULTWRITERPACKAGE_H
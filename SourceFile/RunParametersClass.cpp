@@ -0,0 +1,169 @@
+/*
+	This is cpp file of the class of "RunParametersClass" that reads the parameters controlling the execution of the simulation, such as the random seed and caches, from a ".ini" file and provides them.
+*/
+
+#include "RunParametersClass.h"
+
+/*
+	This constructor reads the execution parameters from a ".ini" file and initialize them.
+*/
+RunParametersClass::RunParametersClass(const std::string& iniFilePath) {
+	InitializeProperties(this);
+	ReadIniFilePackage ReadIniFile = ReadIniFilePackage(iniFilePath);
+	int enable;
+	ReadIniFile.ReadIni("Run Parameters", "Seed", _seed);
+	ReadIniFile.ReadIni("Run-Up Cache", "Enable", enable);
+	_runUpCacheEnabled = (enable != 0);
+	ReadIniFile.ReadIni("Run-Up Cache", "Folder", _runUpCacheFolderPath);
+	ReadIniFile.ReadIni("Run-Up Cache", "Max Size", _runUpCacheMaxSize);
+	ReadIniFile.ReadIni("Result Cache", "Enable", enable);
+	_resultCacheEnabled = (enable != 0);
+	ReadIniFile.ReadIni("Result Cache", "Folder", _resultCacheFolderPath);
+	ReadIniFile.ReadIni("Result Cache", "Max Size", _resultCacheMaxSize);
+	ReadIniFile.ReadIni("Checkpoint", "Enable", enable);
+	_checkpointEnabled = (enable != 0);
+	ReadIniFile.ReadIni("Checkpoint", "Folder", _checkpointFolderPath);
+	ReadIniFile.ReadIni("Checkpoint", "Interval", _checkpointInterval);
+	ReadIniFile.ReadIni("Adaptive Sweep", "Enable", enable);
+	_adaptiveSweepEnabled = (enable != 0);
+	ReadIniFile.ReadIni("Adaptive Sweep", "Initial Step", _adaptiveSweepInitialStep);
+	ReadIniFile.ReadIni("Adaptive Sweep", "Tolerance", _adaptiveSweepTolerance);
+	ReadIniFile.ReadIni("Adaptive Sweep", "Variance Tolerance", _adaptiveSweepVarianceTolerance);
+	ReadIniFile.ReadIni("Adaptive Sweep", "Max Points", _adaptiveSweepMaxPoints);
+	ReadIniFile.ReadIni("Retry", "Max Attempts", _retryMaxAttempts);
+	ReadIniFile.ReadIni("Retry", "Failure Log", enable);
+	_failureLogEnabled = (enable != 0);
+	ReadIniFile.ReadIni("Output", "Sync Interval", _outputSyncInterval);
+	ReadIniFile.ReadIni("Live State", "Enable", enable);
+	_liveStateEnabled = (enable != 0);
+	ReadIniFile.ReadIni("Live State", "Interval", _liveStateInterval);
+	if (_liveStateInterval < 1) {
+		throw std::invalid_argument("Invalid Live State Interval:" + std::to_string(_liveStateInterval));
+	}
+	ReadIniFile.ReadIni("Flight Recorder", "Enable", enable);
+	_flightRecorderEnabled = (enable != 0);
+	ReadIniFile.ReadIni("Flight Recorder", "Folder", _flightRecorderFolderPath);
+	ReadIniFile.ReadIni("Flight Recorder", "Steps", _flightRecorderSteps);
+	if (_flightRecorderSteps < 1) {
+		throw std::invalid_argument("Invalid Flight Recorder Steps:" + std::to_string(_flightRecorderSteps));
+	}
+}
+
+void RunParametersClass::InitializeProperties(RunParametersClass* const thisPtr) {
+	Seed(std::bind(&RunParametersClass::Get_Seed, thisPtr));
+	RunUpCacheEnabled(std::bind(&RunParametersClass::Get_RunUpCacheEnabled, thisPtr));
+	RunUpCacheFolderPath(std::bind(&RunParametersClass::Get_RunUpCacheFolderPath, thisPtr));
+	RunUpCacheMaxSize(std::bind(&RunParametersClass::Get_RunUpCacheMaxSize, thisPtr));
+	ResultCacheEnabled(std::bind(&RunParametersClass::Get_ResultCacheEnabled, thisPtr));
+	ResultCacheFolderPath(std::bind(&RunParametersClass::Get_ResultCacheFolderPath, thisPtr));
+	ResultCacheMaxSize(std::bind(&RunParametersClass::Get_ResultCacheMaxSize, thisPtr));
+	CheckpointEnabled(std::bind(&RunParametersClass::Get_CheckpointEnabled, thisPtr));
+	CheckpointFolderPath(std::bind(&RunParametersClass::Get_CheckpointFolderPath, thisPtr));
+	CheckpointInterval(std::bind(&RunParametersClass::Get_CheckpointInterval, thisPtr));
+	AdaptiveSweepEnabled(std::bind(&RunParametersClass::Get_AdaptiveSweepEnabled, thisPtr));
+	AdaptiveSweepInitialStep(std::bind(&RunParametersClass::Get_AdaptiveSweepInitialStep, thisPtr));
+	AdaptiveSweepTolerance(std::bind(&RunParametersClass::Get_AdaptiveSweepTolerance, thisPtr));
+	AdaptiveSweepVarianceTolerance(std::bind(&RunParametersClass::Get_AdaptiveSweepVarianceTolerance, thisPtr));
+	AdaptiveSweepMaxPoints(std::bind(&RunParametersClass::Get_AdaptiveSweepMaxPoints, thisPtr));
+	RetryMaxAttempts(std::bind(&RunParametersClass::Get_RetryMaxAttempts, thisPtr));
+	FailureLogEnabled(std::bind(&RunParametersClass::Get_FailureLogEnabled, thisPtr));
+	OutputSyncInterval(std::bind(&RunParametersClass::Get_OutputSyncInterval, thisPtr));
+	LiveStateEnabled(std::bind(&RunParametersClass::Get_LiveStateEnabled, thisPtr));
+	LiveStateInterval(std::bind(&RunParametersClass::Get_LiveStateInterval, thisPtr));
+	FlightRecorderEnabled(std::bind(&RunParametersClass::Get_FlightRecorderEnabled, thisPtr));
+	FlightRecorderFolderPath(std::bind(&RunParametersClass::Get_FlightRecorderFolderPath, thisPtr));
+	FlightRecorderSteps(std::bind(&RunParametersClass::Get_FlightRecorderSteps, thisPtr));
+}
+
+const int& RunParametersClass::Get_Seed() const {
+	return _seed;
+}
+
+const bool& RunParametersClass::Get_RunUpCacheEnabled() const {
+	return _runUpCacheEnabled;
+}
+
+const std::string& RunParametersClass::Get_RunUpCacheFolderPath() const {
+	return _runUpCacheFolderPath;
+}
+
+const double& RunParametersClass::Get_RunUpCacheMaxSize() const {
+	return _runUpCacheMaxSize;
+}
+
+const bool& RunParametersClass::Get_ResultCacheEnabled() const {
+	return _resultCacheEnabled;
+}
+
+const std::string& RunParametersClass::Get_ResultCacheFolderPath() const {
+	return _resultCacheFolderPath;
+}
+
+const double& RunParametersClass::Get_ResultCacheMaxSize() const {
+	return _resultCacheMaxSize;
+}
+
+const bool& RunParametersClass::Get_CheckpointEnabled() const {
+	return _checkpointEnabled;
+}
+
+const std::string& RunParametersClass::Get_CheckpointFolderPath() const {
+	return _checkpointFolderPath;
+}
+
+const double& RunParametersClass::Get_CheckpointInterval() const {
+	return _checkpointInterval;
+}
+
+const bool& RunParametersClass::Get_AdaptiveSweepEnabled() const {
+	return _adaptiveSweepEnabled;
+}
+
+const int& RunParametersClass::Get_AdaptiveSweepInitialStep() const {
+	return _adaptiveSweepInitialStep;
+}
+
+const double& RunParametersClass::Get_AdaptiveSweepTolerance() const {
+	return _adaptiveSweepTolerance;
+}
+
+const double& RunParametersClass::Get_AdaptiveSweepVarianceTolerance() const {
+	return _adaptiveSweepVarianceTolerance;
+}
+
+const int& RunParametersClass::Get_AdaptiveSweepMaxPoints() const {
+	return _adaptiveSweepMaxPoints;
+}
+
+
+const int& RunParametersClass::Get_RetryMaxAttempts() const {
+	return _retryMaxAttempts;
+}
+
+const bool& RunParametersClass::Get_FailureLogEnabled() const {
+	return _failureLogEnabled;
+}
+
+const double& RunParametersClass::Get_OutputSyncInterval() const {
+	return _outputSyncInterval;
+}
+
+const bool& RunParametersClass::Get_LiveStateEnabled() const {
+	return _liveStateEnabled;
+}
+
+const int& RunParametersClass::Get_LiveStateInterval() const {
+	return _liveStateInterval;
+}
+
+const bool& RunParametersClass::Get_FlightRecorderEnabled() const {
+	return _flightRecorderEnabled;
+}
+
+const std::string& RunParametersClass::Get_FlightRecorderFolderPath() const {
+	return _flightRecorderFolderPath;
+}
+
+const int& RunParametersClass::Get_FlightRecorderSteps() const {
+	return _flightRecorderSteps;
+}
@@ -0,0 +1,89 @@
+/*
+	This is header file of the class of "RunParametersClass" that reads the parameters controlling the execution of the simulation, such as the random seed and caches, from a ".ini" file and provides them.
+*/
+
+#ifndef RUNPARAMETERSCLASS_H
+#define RUNPARAMETERSCLASS_H
+#include "ReadIniFilePackage.h"
+#include "ReadOnlyPropertyClass.h"
+
+class RunParametersClass {
+public:
+	RunParametersClass(const std::string& iniFilePath);	//This constructor reads the execution parameters from a ".ini" file and initialize them.
+private:
+	int _seed;
+	bool _runUpCacheEnabled;
+	std::string _runUpCacheFolderPath;
+	double _runUpCacheMaxSize;
+	bool _resultCacheEnabled;
+	std::string _resultCacheFolderPath;
+	double _resultCacheMaxSize;
+	bool _checkpointEnabled;
+	std::string _checkpointFolderPath;
+	double _checkpointInterval;
+	bool _adaptiveSweepEnabled;
+	int _adaptiveSweepInitialStep;
+	double _adaptiveSweepTolerance;
+	double _adaptiveSweepVarianceTolerance;
+	int _adaptiveSweepMaxPoints;
+	int _retryMaxAttempts;
+	bool _failureLogEnabled;
+	double _outputSyncInterval;
+	bool _liveStateEnabled;
+	int _liveStateInterval;
+	bool _flightRecorderEnabled;
+	std::string _flightRecorderFolderPath;
+	int _flightRecorderSteps;
+
+	void InitializeProperties(RunParametersClass* const thisPtr);
+
+	const int& Get_Seed() const;
+	const bool& Get_RunUpCacheEnabled() const;
+	const std::string& Get_RunUpCacheFolderPath() const;
+	const double& Get_RunUpCacheMaxSize() const;
+	const bool& Get_ResultCacheEnabled() const;
+	const std::string& Get_ResultCacheFolderPath() const;
+	const double& Get_ResultCacheMaxSize() const;
+	const bool& Get_CheckpointEnabled() const;
+	const std::string& Get_CheckpointFolderPath() const;
+	const double& Get_CheckpointInterval() const;
+	const bool& Get_AdaptiveSweepEnabled() const;
+	const int& Get_AdaptiveSweepInitialStep() const;
+	const double& Get_AdaptiveSweepTolerance() const;
+	const double& Get_AdaptiveSweepVarianceTolerance() const;
+	const int& Get_AdaptiveSweepMaxPoints() const;
+	const int& Get_RetryMaxAttempts() const;
+	const bool& Get_FailureLogEnabled() const;
+	const double& Get_OutputSyncInterval() const;
+	const bool& Get_LiveStateEnabled() const;
+	const int& Get_LiveStateInterval() const;
+	const bool& Get_FlightRecorderEnabled() const;
+	const std::string& Get_FlightRecorderFolderPath() const;
+	const int& Get_FlightRecorderSteps() const;
+public:
+	ReadOnlyPropertyClass<const int&> Seed;	//0 means that the seed is created from the current time.
+	ReadOnlyPropertyClass<const bool&> RunUpCacheEnabled;
+	ReadOnlyPropertyClass<const std::string&> RunUpCacheFolderPath;
+	ReadOnlyPropertyClass<const double&> RunUpCacheMaxSize;	//MB
+	ReadOnlyPropertyClass<const bool&> ResultCacheEnabled;
+	ReadOnlyPropertyClass<const std::string&> ResultCacheFolderPath;
+	ReadOnlyPropertyClass<const double&> ResultCacheMaxSize;	//MB
+	ReadOnlyPropertyClass<const bool&> CheckpointEnabled;
+	ReadOnlyPropertyClass<const std::string&> CheckpointFolderPath;
+	ReadOnlyPropertyClass<const double&> CheckpointInterval;	//s (wall-clock time)
+	ReadOnlyPropertyClass<const bool&> AdaptiveSweepEnabled;
+	ReadOnlyPropertyClass<const int&> AdaptiveSweepInitialStep;
+	ReadOnlyPropertyClass<const double&> AdaptiveSweepTolerance;	//km/h
+	ReadOnlyPropertyClass<const double&> AdaptiveSweepVarianceTolerance;	//km/h
+	ReadOnlyPropertyClass<const int&> AdaptiveSweepMaxPoints;
+	ReadOnlyPropertyClass<const int&> RetryMaxAttempts;	//0 means that the failed N is not retried.
+	ReadOnlyPropertyClass<const bool&> FailureLogEnabled;
+	ReadOnlyPropertyClass<const double&> OutputSyncInterval;	//s (wall-clock time). 0 means that the result files are not synchronized to the disk.
+	ReadOnlyPropertyClass<const bool&> LiveStateEnabled;
+	ReadOnlyPropertyClass<const int&> LiveStateInterval;	//Time steps between the updates of the shared memory
+	ReadOnlyPropertyClass<const bool&> FlightRecorderEnabled;
+	ReadOnlyPropertyClass<const std::string&> FlightRecorderFolderPath;
+	ReadOnlyPropertyClass<const int&> FlightRecorderSteps;	//Time steps kept in the memory to be dumped when the cars collide
+};
+
+#endif // !RUNPARAMETERSCLASS_H
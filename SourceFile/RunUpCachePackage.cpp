@@ -0,0 +1,49 @@
+/*
+	This is cpp file of the class of "RunUpCachePackage" that saves the state of the model after the run-up to a binary cache file and loads it.
+*/
+
+#include "RunUpCachePackage.h"
+
+//constructor
+RunUpCachePackage::RunUpCachePackage(const std::string& FolderPath, const double& MaxSizeMB, const std::string& ModelIniFilePath, const std::string& DriverIniFilePath, const double& deltaT)
+	: Folder(FolderPath, MaxSizeMB, "CTFMRUC1", ".ruc") {
+	HashPackage hash;
+	hash.Add(std::uint32_t(CodeVersion));
+	hash.AddIniFile(ModelIniFilePath);
+	hash.AddIniFile(DriverIniFilePath);
+	hash.Add(deltaT);
+	configHash = hash.Value();
+}
+
+//destructor
+RunUpCachePackage::~RunUpCachePackage() { }
+
+std::string RunUpCachePackage::CreateKey(const int& N, const unsigned int& Seed) const {
+	HashPackage hash;
+	hash.Add(configHash);
+	hash.Add(std::int32_t(N));
+	hash.Add(std::uint32_t(Seed));
+	return hash.Hex();
+}
+
+/*
+	Restore the state of the entry. If there is no entry, return false.
+	The payload is verified by its checksum before it is decoded, and a payload that cannot be decoded leaves the model as it was.
+*/
+bool RunUpCachePackage::Load(const std::string& key, const ModelStateClass& state) const {
+	std::string payload;
+	if (!Folder.Load(key, payload)) {
+		return false;
+	}
+	std::stringstream SS(payload);
+	return state.Read(SS);
+}
+
+/*
+	Save the state as the entry, and remove the old entries if the cache is too large.
+*/
+void RunUpCachePackage::Store(const std::string& key, const ModelStateClass& state) const {
+	std::stringstream SS;
+	state.Write(SS);
+	Folder.Store(key, SS.str());
+}
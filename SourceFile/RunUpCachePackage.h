@@ -0,0 +1,31 @@
+/*
+	This is header file of the class of "RunUpCachePackage" that saves the state of the model after the run-up to a binary cache file and loads it.
+	Each entry is keyed by a hash of the values of the model ".ini" file and the driver ".ini" file, N, the seed, deltaT and the version of the code.
+	The values of the ".ini" files are hashed as they are read, so the comments and the spaces do not change the key.
+	The entries are kept by "CacheFolderPackage", which bounds the total size of the cache.
+*/
+
+#ifndef RUNUPCACHEPACKAGE_H
+#define RUNUPCACHEPACKAGE_H
+#include <sstream>
+#include <string>
+#include "CacheFolderPackage.h"
+#include "HashPackage.h"
+#include "ModelStateClass.h"
+
+class RunUpCachePackage {
+public:
+	static const std::uint32_t CodeVersion = 1;	//Increase this when a change of the model or of "ModelStateClass" changes the saved state, so that the old entries are not used.
+
+	RunUpCachePackage(const std::string& FolderPath, const double& MaxSizeMB, const std::string& ModelIniFilePath, const std::string& DriverIniFilePath, const double& deltaT);	//constructor
+	~RunUpCachePackage();	//destructor
+
+	std::string CreateKey(const int& N, const unsigned int& Seed) const;
+	bool Load(const std::string& key, const ModelStateClass& state) const;	//Restore the state of the entry. If there is no entry, return false.
+	void Store(const std::string& key, const ModelStateClass& state) const;	//Save the state as the entry, and remove the old entries if the cache is too large.
+private:
+	const CacheFolderPackage Folder;
+	std::uint64_t configHash;
+};
+
+#endif // !RUNUPCACHEPACKAGE_H
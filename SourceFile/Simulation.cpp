@@ -12,20 +12,106 @@ Simulation::Simulation(const std::string& IniFileFolderPath, const int& IniFileN
 		fFDPath = ResultFileFolderPath + R"(/)" + "FD.csv";
 		fGlovalVDPath = ResultFileFolderPath + R"(/)" + "Global_VD.csv";
 		fLocalVDPath = ResultFileFolderPath + R"(/)" + "Local_VD.csv";
+		fFailureLogPath = ResultFileFolderPath + R"(/)" + "Failure_Log.csv";
+		fDetectorFDPath = ResultFileFolderPath + R"(/)" + "Detector_FD.csv";
+		fDetectorVDPath = ResultFileFolderPath + R"(/)" + "Detector_VD.csv";
+		fManifestPath = ResultFileFolderPath + R"(/)" + "Manifest_Ini" + std::to_string(IniFileNumber) + ".manifest";
 	}
 	else {
 		fFDPath = ResultFileFolderPath + R"(/)" + "FD" + std::to_string(RunNumber) + ".csv";
 		fGlovalVDPath = ResultFileFolderPath + R"(/)" + "Global_VD" + std::to_string(RunNumber) + ".csv";
 		fLocalVDPath = ResultFileFolderPath + R"(/)" + "Local_VD" + std::to_string(RunNumber) +  ".csv";
+		fFailureLogPath = ResultFileFolderPath + R"(/)" + "Failure_Log" + std::to_string(RunNumber) + ".csv";
+		fDetectorFDPath = ResultFileFolderPath + R"(/)" + "Detector_FD" + std::to_string(RunNumber) + ".csv";
+		fDetectorVDPath = ResultFileFolderPath + R"(/)" + "Detector_VD" + std::to_string(RunNumber) + ".csv";
+		fManifestPath = ResultFileFolderPath + R"(/)" + "Manifest_Ini" + std::to_string(IniFileNumber) + "_RunN" + std::to_string(RunNumber) + ".manifest";
 	}
+	Manifest = new ManifestPackage(fManifestPath);
 	ModelParameters = new ModelParametersClass(IniFileFolderPath + R"(/ModelParameters.ini)");
 	StatisticsParameters = new StatisticsParametersClass(IniFileFolderPath + R"(/StatisticsParameters.ini)");
+	RunParameters = new RunParametersClass(IniFileFolderPath + R"(/RunParameters.ini)");
+	ProfileParameters = new ProfileParametersClass(IniFileFolderPath + R"(/Ini)" + std::to_string(IniFileNumber) + ".ini");
+	ResultCache = nullptr;
+	if (RunParameters->ResultCacheEnabled && RunParameters->Seed != 0) {
+		ResultCache = new ResultCachePackage(RunParameters->ResultCacheFolderPath, RunParameters->ResultCacheMaxSize, IniFileFolderPath + R"(/ModelParameters.ini)", IniFileFolderPath + R"(/Ini)" + std::to_string(IniFileNumber) + ".ini", IniFileFolderPath + R"(/StatisticsParameters.ini)", RunParameters->RetryMaxAttempts);
+	}
+	RunUpCache = nullptr;
+	if (RunParameters->RunUpCacheEnabled && RunParameters->Seed != 0) {
+		RunUpCache = new RunUpCachePackage(RunParameters->RunUpCacheFolderPath, RunParameters->RunUpCacheMaxSize, IniFileFolderPath + R"(/ModelParameters.ini)", IniFileFolderPath + R"(/Ini)" + std::to_string(IniFileNumber) + ".ini", ModelParameters->deltaT);
+	}
+	Checkpoint = nullptr;
+	if (RunParameters->CheckpointEnabled) {
+		Checkpoint = new CheckpointPackage(RunParameters->CheckpointFolderPath, IniFileNumber, RunNumber, RunParameters->CheckpointInterval, IniFileFolderPath + R"(/ModelParameters.ini)", IniFileFolderPath + R"(/Ini)" + std::to_string(IniFileNumber) + ".ini", IniFileFolderPath + R"(/StatisticsParameters.ini)", RunParameters->Seed, RunParameters->RetryMaxAttempts);
+		//SIGINT and SIGTERM are caught only when the checkpoints can be saved, otherwise the process is terminated as usual.
+		InterruptHandler::Install();
+	}
+	SnapShotArchive = nullptr;
+	if (CreateSnapShot && StatisticsParameters->SnapShotArchive) {
+		FileSystem::MakeDirectories(SnapShotFolderPath);
+		SnapShotArchive = new SnapShotArchivePackage(SnapShotFolderPath + R"(/SnapShot)" + (RunNumber == 0 ? "" : "_RunN" + std::to_string(RunNumber)) + ".snaparc");
+	}
+	FlightRecorder = nullptr;
+	if (RunParameters->FlightRecorderEnabled) {
+		FlightRecorder = new FlightRecorderPackage(RunParameters->FlightRecorderFolderPath, IniFileNumber, RunNumber, RunParameters->FlightRecorderSteps, ModelParameters->deltaT, ModelParameters->L);
+	}
+	SpaceTimeField = nullptr;
+	if (StatisticsParameters->FieldEnabled) {
+		SpaceTimeField = new SpaceTimeFieldPackage(StatisticsParameters->FieldFolderPath, IniFileNumber, RunNumber, StatisticsParameters->FieldFormat, StatisticsParameters->FieldCellLength, StatisticsParameters->FieldCellTime, StatisticsParameters->UnitMeasurementTime, ModelParameters->L, ModelParameters->deltaT, StatisticsParameters->CSVSignificantDigits);
+	}
+	JamTracker = nullptr;
+	if (StatisticsParameters->JamEnabled) {
+		JamTracker = new JamTrackerPackage(StatisticsParameters->JamFolderPath, IniFileNumber, RunNumber, StatisticsParameters->JamInterval, StatisticsParameters->JamSpeedThreshold, StatisticsParameters->JamGapThreshold, StatisticsParameters->JamMinCars, ModelParameters->L, ModelParameters->deltaT, StatisticsParameters->CSVSignificantDigits);
+	}
+	TimeSeries = nullptr;
+	if (StatisticsParameters->TimeSeriesEnabled) {
+		TimeSeries = new TimeSeriesPackage(StatisticsParameters->TimeSeriesFolderPath, IniFileNumber, RunNumber, StatisticsParameters->TimeSeriesFormat, StatisticsParameters->TimeSeriesInterval, ModelParameters->L, ModelParameters->deltaT, StatisticsParameters->CSVSignificantDigits);
+	}
+	DetectorArray = nullptr;
+	const std::vector<DetectorArrayPackage::Detector>& detectors = StatisticsParameters->Detectors;
+	if (!detectors.empty()) {
+		DetectorArray = new DetectorArrayPackage(detectors, StatisticsParameters->UnitMeasurementTime, ModelParameters->L, ModelParameters->deltaT);
+	}
+	LiveState = nullptr;
+	if (RunParameters->LiveStateEnabled) {
+#ifdef _OPENMP
+		const int&& slots = omp_get_max_threads();
+#else
+		const int slots = 1;
+#endif // _OPENMP
+		LiveState = new LiveStatePackage(LiveStatePackage::GetName(IniFileNumber, RunNumber), RunParameters->LiveStateInterval, slots, ModelParameters->NMax, IniFileNumber, RunNumber, ModelParameters->L, ModelParameters->deltaT);
+		if (LiveState->GetRunningOwner() != 0) {
+			std::cerr << "The live state is not published, because it is published by the running process " << LiveState->GetRunningOwner() << ":" << LiveStatePackage::GetName(IniFileNumber, RunNumber) << std::endl;
+		}
+		else if (!LiveState->IsOpen()) {
+			std::cerr << "The live state cannot be published:" << LiveStatePackage::GetName(IniFileNumber, RunNumber) << std::endl;
+		}
+	}
+	ResultWriter = nullptr;
+	AdaptiveSweep = nullptr;
+	if (RunParameters->AdaptiveSweepEnabled) {
+		AdaptiveSweep = new AdaptiveSweepPackage(ModelParameters->NMax, RunParameters->AdaptiveSweepInitialStep, RunParameters->AdaptiveSweepTolerance, RunParameters->AdaptiveSweepVarianceTolerance, RunParameters->AdaptiveSweepMaxPoints);
+	}
 }
 
 //destructor
 Simulation::~Simulation() {
 	SafeDelete(ModelParameters);		//delete ModelParametersClass
 	SafeDelete(StatisticsParameters);	//delete StatisticsParametersClass
+	SafeDelete(RunParameters);	//delete RunParametersClass
+	SafeDelete(ProfileParameters);	//delete ProfileParametersClass
+	SafeDelete(RunUpCache);	//delete RunUpCachePackage
+	SafeDelete(ResultCache);	//delete ResultCachePackage
+	SafeDelete(Checkpoint);	//delete CheckpointPackage
+	SafeDelete(AdaptiveSweep);	//delete AdaptiveSweepPackage
+	SafeDelete(SnapShotArchive);	//delete SnapShotArchivePackage. The directory is written.
+	SafeDelete(ResultWriter);	//delete ResultWriterPackage
+	SafeDelete(Manifest);	//delete ManifestPackage
+	SafeDelete(FlightRecorder);	//delete FlightRecorderPackage
+	SafeDelete(SpaceTimeField);	//delete SpaceTimeFieldPackage
+	SafeDelete(JamTracker);	//delete JamTrackerPackage
+	SafeDelete(TimeSeries);	//delete TimeSeriesPackage
+	SafeDelete(DetectorArray);	//delete DetectorArrayPackage
+	SafeDelete(LiveState);	//delete LiveStatePackage. The shared memory is removed.
 }
 
 /*
@@ -35,92 +121,259 @@ Simulation::~Simulation() {
 void Simulation::simulate() {
 	bool&& isFirstSimulation = CreateNLists();
 	WriteCSVHeaderToCSV(isFirstSimulation);
+	ResultWriter = new ResultWriterPackage(fFDPath, fGlovalVDPath, fLocalVDPath, fFailureLogPath, fDetectorFDPath, fDetectorVDPath, RunParameters->OutputSyncInterval, Manifest);
+	if (AdaptiveSweep == nullptr) {
+		SimulateNLists();
+	}
+	else {
+		//Simulate the N chosen by the adaptive sweep round by round, until it has been converged.
+		NLists = AdaptiveSweep->NextNLists();
+		while (!NLists.empty() && !InterruptHandler::Requested()) {
+			SimulateNLists();
+			NLists = AdaptiveSweep->NextNLists();
+		}
+	}
+	SafeDelete(ResultWriter);	//All results are written before this returns.
+}
+
+/*
+	Perform calculations for each number of cars in the NLists.
+*/
+void Simulation::SimulateNLists() {
 #ifdef _OPENMP
 #pragma omp parallel for schedule(guided)
 #endif //  _OPENMP
 	for (int i = 0; i < int(NLists.size()); i++) {
+		if (InterruptHandler::Requested()) {
+			continue;	//The remaining N are simulated at the next execution.
+		}
 		int N = NLists[i];
 		std::stringstream sResultFD;
 		std::stringstream sResultGlovalVD;
 		std::stringstream sResultLocalVD;
+		double localStandardDeviation = 0;
+		const unsigned int&& seed = Random::CreateSeed(RunNumber, RunParameters->Seed);
+		const std::chrono::steady_clock::time_point&& start = std::chrono::steady_clock::now();
+		ManifestPackage::Entry entry = Manifest->Get(N);
+		entry.N = N;
+		entry.Seed = seed;
+		//The results of the same parameters and seed are taken from the cache without the simulation, unless the files of the measurements or the results of the detectors are written.
+		const std::string&& cacheKey = ResultCache != nullptr ? ResultCache->CreateKey(N, seed) : std::string();
+		ResultCachePackage::Result cached;
+		if (ResultCache != nullptr && !CreateSnapShot && SpaceTimeField == nullptr && JamTracker == nullptr && TimeSeries == nullptr && DetectorArray == nullptr && ResultCache->Load(cacheKey, cached)) {
+			ResultWriterPackage::Record record;
+			record.FD = cached.FD;
+			record.GlobalVD = cached.GlobalVD;
+			record.LocalVD = cached.LocalVD;
+			record.Console = cached.GlobalVD;
+			entry.Status = ManifestPackage::Done;
+			entry.Seed = cached.Seed;
+			entry.WallTime = 0;
+			entry.V = cached.V;
+			entry.LocalStandardDeviation = cached.LocalStandardDeviation;
+			record.Entry = entry;
+			ResultWriter->Push(std::move(record));
+			if (AdaptiveSweep != nullptr) {
+#ifdef  _OPENMP
+#pragma omp critical
+#endif //  _OPENMP
+				{
+					AdaptiveSweep->AddResult(N, cached.V, cached.LocalStandardDeviation);
+				}
+			}
+			continue;
+		}
+		entry.Status = ManifestPackage::Running;
+		Manifest->Write(entry);
 		//Model execution class construct and initialize model.
-		AdvanceTimeAndMeasureClass* AdvanceTime = new AdvanceTimeAndMeasureClass(IniFileFolderPath, IniFileNumber, N, *ModelParameters, *StatisticsParameters, CreateSnapShot, RunNumber, SnapShotFolderPath);	
+		AdvanceTimeAndMeasureClass* AdvanceTime = new AdvanceTimeAndMeasureClass(*ProfileParameters, N, *ModelParameters, *StatisticsParameters, CreateSnapShot, RunNumber, seed, SnapShotFolderPath, SnapShotArchive, RunUpCache, Checkpoint, FlightRecorder, SpaceTimeField, JamTracker, TimeSeries, DetectorArray, LiveState);
 		if (AdvanceTime->InitializeSuccess) {
 			AdvanceTime->AdvanceTimeAndMeasure();	//run-up and measurement
+			std::uint32_t attempts = 1;
+			//When the cars collide, the simulation is started over with a new seed in this worker.
+			//After a checkpoint is resumed, the retries continue from its attempt and seed.
+			const unsigned int&& baseSeed = AdvanceTime->CurrentSeed - (unsigned int)AdvanceTime->Attempt;
+			for (int attempt = AdvanceTime->Attempt; !AdvanceTime->Interrupted && !AdvanceTime->SuccedMeasure; attempt++) {
+				if (RunParameters->FailureLogEnabled && AdvanceTime->InitializeSuccess) {
+					WriteFailureToCSV(N, baseSeed + (unsigned int)attempt, attempt, AdvanceTime->Failure);
+				}
+				if (attempt >= RunParameters->RetryMaxAttempts || !AdvanceTime->Reinitialize(attempt + 1, baseSeed + (unsigned int)(attempt + 1))) {
+					break;
+				}
+				AdvanceTime->AdvanceTimeAndMeasure();
+				attempts++;
+			}
+			entry.Seed = AdvanceTime->CurrentSeed;
+			entry.Attempts += attempts;
+			const std::chrono::duration<double>&& wallTime = std::chrono::steady_clock::now() - start;
+			entry.WallTime = wallTime.count();
 			if (AdvanceTime->SuccedMeasure) {
 				//create each result stringstreams
 				const StatisticsClass* const statistics = AdvanceTime->Statistics();
 				const StatisticsElementsClass* const Global = statistics->Global;
+				const int& digits = StatisticsParameters->CSVSignificantDigits;
 				for (std::size_t j = 0; j < statistics->Local->size(); j++) {
 					const StatisticsElementsClass* const local = (*statistics->Local)[j];
-					sResultFD << N << "," << local->K << "," << local->Counter << "," << j + 1 << std::endl;
-					sResultLocalVD << N << "," << local->K << "," << Calculate_m_s_To_Km_h(local->AverageVelocity) << "," << j + 1 << std::endl;
+					sResultFD << N << "," << DoubleFormat::Text(local->K, digits) << "," << local->Counter << "," << j + 1 << std::endl;
+					sResultLocalVD << N << "," << DoubleFormat::Text(local->K, digits) << "," << DoubleFormat::Text(Calculate_m_s_To_Km_h(local->AverageVelocity), digits) << "," << j + 1 << std::endl;
 				}
-				sResultGlovalVD << N << "," << Global->K << "," << Calculate_m_s_To_Km_h(Global->AverageVelocity) << std::endl;
+				sResultGlovalVD << N << "," << DoubleFormat::Text(Global->K, digits) << "," << DoubleFormat::Text(Calculate_m_s_To_Km_h(Global->AverageVelocity), digits) << std::endl;
+				//The standard deviation of the local velocities between the measurements, which is used by the adaptive sweep.
+				double sum = 0;
+				double sum2 = 0;
+				const std::size_t&& n = statistics->Local->size();
+				for (std::size_t j = 0; j < n; j++) {
+					const double&& v = Calculate_m_s_To_Km_h((*statistics->Local)[j]->AverageVelocity);
+					sum += v;
+					sum2 += v * v;
+				}
+				localStandardDeviation = n > 1 ? std::sqrt((std::max)((sum2 - sum * sum / n) / (n - 1), 0.0)) : 0;
 			}
-			if (AdvanceTime->SuccedMeasure) {
+			if (AdvanceTime->Interrupted) {
+				//The progress has been saved to the checkpoint, and it is resumed at the next execution.
+			}
+			else if (AdvanceTime->SuccedMeasure) {
+				//write results
+				ResultCachePackage::Result result;
+				result.FD = sResultFD.str();
+				result.GlobalVD = sResultGlovalVD.str();
+				result.LocalVD = sResultLocalVD.str();
+				result.V = Calculate_m_s_To_Km_h(AdvanceTime->Statistics()->Global->AverageVelocity);
+				result.LocalStandardDeviation = localStandardDeviation;
+				result.Seed = entry.Seed;
+				result.Attempts = std::uint32_t(AdvanceTime->Attempt + 1);
+				if (ResultCache != nullptr) {
+					ResultCache->Store(cacheKey, result);
+				}
+				ResultWriterPackage::Record record;
+				record.FD = result.FD;
+				record.GlobalVD = result.GlobalVD;
+				record.LocalVD = result.LocalVD;
+				if (DetectorArray != nullptr) {
+					record.DetectorFD = DetectorArray->FDText(*AdvanceTime->DetectorCounters(), N, StatisticsParameters->CSVSignificantDigits);
+					record.DetectorVD = DetectorArray->VDText(*AdvanceTime->DetectorCounters(), N, StatisticsParameters->CSVSignificantDigits);
+				}
+				std::stringstream sConsole;
+				sConsole << record.GlobalVD;
+				if (AdvanceTime->SnapShotStallCount() > 0) {
+					//The disk could not keep up with the simulation.
+					sConsole << "SnapShot Stall N::" << N << " Steps::" << AdvanceTime->SnapShotStallCount() << " Time::" << AdvanceTime->SnapShotStallTime() << "s" << std::endl;
+				}
+				sConsole << AdvanceTime->SnapShotReport();
+				record.Console = sConsole.str();
+				entry.Status = ManifestPackage::Done;
+				entry.V = result.V;
+				entry.LocalStandardDeviation = localStandardDeviation;
+				record.Entry = entry;	//"Done" is written after the results.
+				ResultWriter->Push(std::move(record));
+				if (AdaptiveSweep != nullptr) {
 #ifdef  _OPENMP
 #pragma omp critical
 #endif //  _OPENMP
-				{
-					//write results
-					WriteResultToCSV(sResultFD, sResultGlovalVD, sResultLocalVD);
-					std::cout << sResultGlovalVD.str();
+					{
+						AdaptiveSweep->AddResult(N, result.V, localStandardDeviation);
+					}
 				}
 			}
 			else {
+				ResultWriterPackage::Record record;
+				record.Console = "Error N::" + std::to_string(N) + "\n";
+				ResultWriter->Push(std::move(record));
+				entry.Status = ManifestPackage::Failed;
+				Manifest->Write(entry);
+				if (AdaptiveSweep != nullptr) {
+#ifdef  _OPENMP
+#pragma omp critical
+#endif //  _OPENMP
+					{
+						AdaptiveSweep->AddFailure(N);
+					}
+				}
+			}
+		}
+		else {
+			entry.Status = ManifestPackage::Failed;	//The cars cannot be placed on the road.
+			Manifest->Write(entry);
+			if (AdaptiveSweep != nullptr) {
 #ifdef  _OPENMP
 #pragma omp critical
 #endif //  _OPENMP
 				{
-					std::cout << "Error N::" << N << std::endl;
+					AdaptiveSweep->AddFailure(N);
 				}
 			}
-			delete AdvanceTime;	//delete AdvanceTimeAndMeasureClass
 		}
+		delete AdvanceTime;	//delete AdvanceTimeAndMeasureClass
 	}
 }
 
 /*
 	A function that creates the NLists excluding those that results have already been created.
+	The N recorded as "Done" in the manifest are excluded, unless their lines are missing from the result files.
+	The failed N and the N interrupted or crashed are simulated again.
 */
 bool  Simulation::CreateNLists() {
-	bool isFirstSimulation = true;
-	std::ifstream ifs(fGlovalVDPath);
-	std::size_t listSize = ModelParameters->NMax;
-	std::vector<bool> NListsFG(listSize, true);
-	if (ifs) {
-		std::string S;
-		std::getline(ifs, S);
-		if (S != "") {
-			isFirstSimulation = false;
-		}
-		int N;
-		double val;
-		char ch;
-		std::stringstream SS;
-		while (std::getline(ifs, S)) {
-			if (S == "") {
-				break;
+	const bool&& isFirstSimulation = FileSystem::FileSize(fGlovalVDPath) <= 0;
+	if (!isFirstSimulation && Manifest->Empty()) {
+		ImportGlobalVD();
+	}
+	const std::int64_t&& FDSize = FileSystem::FileSize(fFDPath);
+	const std::int64_t&& GlobalVDSize = FileSystem::FileSize(fGlovalVDPath);
+	const std::int64_t&& LocalVDSize = FileSystem::FileSize(fLocalVDPath);
+	for (int N = 1; N <= ModelParameters->NMax; N++) {
+		const ManifestPackage::Entry&& entry = Manifest->Get(N);
+		if (entry.Status == ManifestPackage::Done
+			&& std::int64_t(entry.FDOffset + entry.FDSize) <= FDSize
+			&& std::int64_t(entry.GlobalVDOffset + entry.GlobalVDSize) <= GlobalVDSize
+			&& std::int64_t(entry.LocalVDOffset + entry.LocalVDSize) <= LocalVDSize) {
+			if (AdaptiveSweep != nullptr) {
+				AdaptiveSweep->AddResult(N, entry.V, entry.LocalStandardDeviation);
 			}
-			SS << S;
-			SS >> N >> ch >> val >> ch >> val;
-			NListsFG[N - 1] = false;
-			listSize--;
-			SS.str("");
-			SS.clear(std::stringstream::goodbit);
+		}
+		else {
+			NLists.emplace_back(N);
 		}
 	}
-	ifs.close();
+	return isFirstSimulation;
+}
 
-	if (listSize > 0) {
-		for (std::size_t i = 0; i < NListsFG.size(); i++) {
-			if (NListsFG[i]) {
-				NLists.emplace_back(int(i + 1));
+/*
+	Record the N in "Global_VD.csv" written without the manifest as "Done".
+	The line that is not complete, such as the one torn by a crash, is ignored.
+	The local velocities are not kept in the file, so their standard deviation is 0.
+*/
+void Simulation::ImportGlobalVD() {
+	std::ifstream ifs(fGlovalVDPath, std::ios::binary);
+	std::string S;
+	std::getline(ifs, S);	//header
+	std::uint64_t offset = std::uint64_t(ifs.tellg());
+	while (std::getline(ifs, S) && !ifs.eof()) {
+		const std::uint64_t&& size = S.size() + 1;
+		const char* const begin = S.c_str();
+		char* end;
+		const long&& N = std::strtol(begin, &end, 10);
+		if (end != begin && *end == ',' && N >= 1 && N <= ModelParameters->NMax) {
+			const char* const kBegin = end + 1;
+			std::strtod(kBegin, &end);
+			const char* const vBegin = end + 1;
+			if (end != kBegin && *end == ',') {
+				const double&& V = std::strtod(vBegin, &end);
+				if (end != vBegin) {
+					ManifestPackage::Entry entry;
+					entry.N = std::int32_t(N);
+					entry.Status = ManifestPackage::Done;
+					entry.V = V;
+					entry.GlobalVDOffset = offset;
+					entry.GlobalVDSize = std::uint32_t(size);
+					Manifest->Write(entry);
+				}
 			}
 		}
+		offset += size;
 	}
-	return isFirstSimulation;
+	ifs.close();
+	SafeDelete(Manifest);	//The records are read again.
+	Manifest = new ManifestPackage(fManifestPath);
 }
 
 /*
@@ -140,14 +393,20 @@ void Simulation::WriteCSVHeaderToCSV(const bool& isFirstSimulation) {
 	}
 }
 
-void Simulation::WriteResultToCSV(const std::stringstream& sResultFD, const std::stringstream& sResultGlovalVD, const std::stringstream& sResultLocalVD) {
-	std::ofstream ofsFD(fFDPath, std::ios::app);
-	std::ofstream ofsGlovalVD(fGlovalVDPath, std::ios::app);
-	std::ofstream ofsLocalVD(fLocalVDPath, std::ios::app);
-	ofsFD << sResultFD.str();
-	ofsGlovalVD << sResultGlovalVD.str();
-	ofsLocalVD << sResultLocalVD.str();
-	ofsFD.close();
-	ofsGlovalVD.close();
-	ofsLocalVD.close();
+/*
+	Record where and between which cars the simulation failed.
+*/
+void Simulation::WriteFailureToCSV(const int& N, const unsigned int& Seed, const int& Attempt, const AdvanceTimeAndMeasureClass::FailureInformation& Failure) {
+	std::stringstream SS;
+	SS << N << "," << Seed << "," << Attempt << "," << Failure.Phase << "," << Failure.MeasureNumber << "," << Failure.Step << "," << DoubleFormat::Text(Failure.Time, StatisticsParameters->CSVSignificantDigits) << ",";
+	for (std::size_t i = 0; i < Failure.IDs.size(); i++) {
+		if (i > 0) {
+			SS << " ";
+		}
+		SS << Failure.IDs[i] + 1;	//The cars are numbered from 1 as in the snapshots.
+	}
+	SS << std::endl;
+	ResultWriterPackage::Record record;
+	record.FailureLog = SS.str();
+	ResultWriter->Push(std::move(record));
 }
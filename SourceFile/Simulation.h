@@ -4,12 +4,34 @@
 
 #ifndef SIMULATION_H
 #define SIMULATION_H
+#include <chrono>
+#include <cmath>
 #include <fstream>
 #include <sstream>
 #include <string>
+#include "DoubleFormatPackage.h"
 #include "ModelParametersClass.h"
 #include "StatisticsParametersClass.h"
+#include "RunParametersClass.h"
+#include "ProfileParametersClass.h"
+#include "RunUpCachePackage.h"
+#include "ResultCachePackage.h"
+#include "CheckpointPackage.h"
+#include "InterruptHandlerPackage.h"
+#include "AdaptiveSweepPackage.h"
 #include "AdvanceTimeAndMeasureClass.h"
+#include "FileSystemPackage.h"
+#include "ManifestPackage.h"
+#include "ResultWriterPackage.h"
+#include "LiveStatePackage.h"
+#include "FlightRecorderPackage.h"
+#include "SpaceTimeFieldPackage.h"
+#include "JamTrackerPackage.h"
+#include "TimeSeriesPackage.h"
+#include "DetectorArrayPackage.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif // _OPENMP
 
 class Simulation {
 public:
@@ -25,15 +47,36 @@ private:
 
 	const ModelParametersClass* ModelParameters;				//Model parameters such as road length
 	const StatisticsParametersClass* StatisticsParameters;	//Parameters for measuring results
+	const ProfileParametersClass* ProfileParameters;	//Car and driver-specific information read once for all N
+	const RunParametersClass* RunParameters;	//Parameters for controlling the execution such as the seed and caches
+	const RunUpCachePackage* RunUpCache;	//Cache of the states after the run-up. nullptr if it is disabled.
+	ResultCachePackage* ResultCache;	//Cache of the results of each N. nullptr if it is disabled or the seed is not fixed.
+	const CheckpointPackage* Checkpoint;	//Checkpoints of the simulations in progress. nullptr if they are disabled.
+	AdaptiveSweepPackage* AdaptiveSweep;	//Chooses N adaptively. nullptr if every N is simulated.
+	SnapShotArchivePackage* SnapShotArchive;	//Archive of the snapshots. nullptr if each measurement is written to a file.
+	ResultWriterPackage* ResultWriter;	//Writes the results on the output thread while "simulate" is running.
+	FlightRecorderPackage* FlightRecorder;	//nullptr if the flight recorder is disabled.
+	SpaceTimeFieldPackage* SpaceTimeField;	//nullptr if the field is not written.
+	JamTrackerPackage* JamTracker;	//nullptr if the clusters are not tracked.
+	TimeSeriesPackage* TimeSeries;	//nullptr if the time series is not written.
+	DetectorArrayPackage* DetectorArray;	//nullptr if there is no detector other than that of "Statistics Parameters".
+	LiveStatePackage* LiveState;	//The shared memory of the simulations in progress. nullptr if it is disabled.
+	ManifestPackage* Manifest;	//The progress of each N, which decides the N to be simulated when this is resumed.
 	std::vector<int> NLists;	//List of number of cars to be calculated
 	//The following is related to result creation.
 	std::string fFDPath;
 	std::string fGlovalVDPath;
 	std::string fLocalVDPath;
+	std::string fFailureLogPath;
+	std::string fDetectorFDPath;
+	std::string fDetectorVDPath;
+	std::string fManifestPath;
 
 	bool CreateNLists();		//A function that creates the NLists excluding those that results have already been created.
+	void ImportGlobalVD();	//Record the N in "Global_VD.csv" written without the manifest as "Done".
+	void SimulateNLists();	//Perform calculations for each number of cars in the NLists.
 	void WriteCSVHeaderToCSV(const bool& isFirstSimulation);	//Write each header to CSV when this is simulated it for the first time.
-	void WriteResultToCSV(const std::stringstream& sResultFD, const std::stringstream& sResultGlovalVD, const std::stringstream& sResultLocalVD);
+	void WriteFailureToCSV(const int& N, const unsigned int& Seed, const int& Attempt, const AdvanceTimeAndMeasureClass::FailureInformation& Failure);	//Record where and between which cars the simulation failed.
 };
 
 #endif // !SIMULATION_H
@@ -0,0 +1,234 @@
+/*
+	This is cpp file of the class of "SnapShotArchivePackage" that appends the snapshots of an ini file and a run to a single archive file.
+*/
+
+#include "SnapShotArchivePackage.h"
+
+namespace {
+	const char HeaderMagic[8] = { 'C', 'T', 'F', 'M', 'A', 'R', 'C', '1' };
+	const char EntryMagic[8] = { 'C', 'T', 'F', 'M', 'A', 'E', 'N', 'T' };
+	const char DirectoryMagic[8] = { 'C', 'T', 'F', 'M', 'A', 'D', 'I', 'R' };
+	const char EndMagic[8] = { 'C', 'T', 'F', 'M', 'A', 'E', 'N', 'D' };
+
+	bool ReadMagic(std::istream& is, const char(&magic)[8]) {
+		char buffer[8];
+		is.read(buffer, sizeof(buffer));
+		return bool(is) && std::equal(buffer, buffer + sizeof(buffer), magic);
+	}
+
+	//A name longer than the rest of the file is broken.
+	bool ReadName(std::istream& is, const std::uint64_t& fileSize, std::string& name) {
+		std::uint64_t length;
+		if (!BinaryIO::Read(is, length) || length > fileSize - std::uint64_t(is.tellg())) {
+			return false;
+		}
+		name.resize(std::size_t(length));
+		if (length > 0) {
+			is.read(&name[0], std::streamsize(length));
+		}
+		return bool(is);
+	}
+
+	//The offset of the next entry after "from". The end of the file if there is none.
+	std::uint64_t FindEntry(std::istream& is, std::uint64_t from, const std::uint64_t& fileSize) {
+		std::vector<char> chunk(std::size_t(1) << 20);
+		while (from + sizeof(EntryMagic) <= fileSize) {
+			const std::size_t&& n = std::size_t(std::min(std::uint64_t(chunk.size()), fileSize - from));
+			is.clear();
+			is.seekg(std::streamoff(from));
+			is.read(chunk.data(), std::streamsize(n));
+			const std::vector<char>::iterator&& found = std::search(chunk.begin(), chunk.begin() + std::ptrdiff_t(n), EntryMagic, EntryMagic + sizeof(EntryMagic));
+			if (found != chunk.begin() + std::ptrdiff_t(n)) {
+				return from + std::uint64_t(found - chunk.begin());
+			}
+			if (n < chunk.size()) {
+				break;
+			}
+			from += n - (sizeof(EntryMagic) - 1);
+		}
+		return fileSize;
+	}
+}
+
+/*
+	Open the archive to append. The entries in the existing archive are kept.
+	If the file is not an archive, it is overwritten.
+*/
+SnapShotArchivePackage::SnapShotArchivePackage(const std::string& path) {
+	const std::int64_t&& fileSize = FileSystem::FileSize(path);
+	bool append = false;
+	if (fileSize > 0) {
+		std::ifstream ifs(path, std::ios::binary);
+		bool complete;
+		append = ReadDirectory(ifs, std::uint64_t(fileSize), entries, complete);
+	}
+	if (append) {
+		ofs.open(path, std::ios::binary | std::ios::app);
+		size = std::uint64_t(fileSize);
+	}
+	else {
+		entries.clear();
+		ofs.open(path, std::ios::binary | std::ios::trunc);
+		ofs.write(HeaderMagic, sizeof(HeaderMagic));
+		ofs.flush();
+		size = sizeof(HeaderMagic);
+	}
+}
+
+//destructor
+SnapShotArchivePackage::~SnapShotArchivePackage() {
+	Close();
+}
+
+/*
+	This can be called by the workers at the same time.
+	The entry is written at once and flushed, so the entries of the other workers are never mixed into it.
+*/
+bool SnapShotArchivePackage::Append(const int& N, const int& MeasureNumber, const std::string& name, const std::string& data) {
+	std::lock_guard<std::mutex> lock(archiveMutex);
+	if (!ofs.is_open()) {
+		return false;
+	}
+	ofs.write(EntryMagic, sizeof(EntryMagic));
+	BinaryIO::Write(ofs, std::int32_t(N));
+	BinaryIO::Write(ofs, std::int32_t(MeasureNumber));
+	BinaryIO::WriteString(ofs, name);
+	BinaryIO::Write(ofs, std::uint64_t(data.size()));
+	ofs.write(data.data(), std::streamsize(data.size()));
+	ofs.flush();
+	const std::uint64_t&& headSize = sizeof(EntryMagic) + 2 * sizeof(std::int32_t) + sizeof(std::uint64_t) + name.size() + sizeof(std::uint64_t);
+	entries.push_back(Entry{ std::int32_t(N), std::int32_t(MeasureNumber), size + headSize, std::uint64_t(data.size()), name });
+	size += headSize + data.size();
+	return bool(ofs);
+}
+
+/*
+	Write the directory, and close the archive.
+*/
+void SnapShotArchivePackage::Close() {
+	std::lock_guard<std::mutex> lock(archiveMutex);
+	if (!ofs.is_open()) {
+		return;
+	}
+	SelectValidEntries(entries);
+	ofs.write(DirectoryMagic, sizeof(DirectoryMagic));
+	BinaryIO::Write(ofs, std::uint64_t(entries.size()));
+	for (const Entry& entry : entries) {
+		BinaryIO::Write(ofs, entry.N);
+		BinaryIO::Write(ofs, entry.MeasureNumber);
+		BinaryIO::Write(ofs, entry.Offset);
+		BinaryIO::Write(ofs, entry.Length);
+		BinaryIO::WriteString(ofs, entry.Name);
+	}
+	BinaryIO::Write(ofs, size);
+	ofs.write(EndMagic, sizeof(EndMagic));
+	ofs.close();
+}
+
+/*
+	The valid entries in the order of N and measurement number.
+	"complete" is false if the directory is not found at the end, and the entries are found by scanning the records.
+	If the file is not an archive, return false.
+*/
+bool SnapShotArchivePackage::ReadDirectory(std::istream& is, const std::uint64_t& fileSize, std::vector<Entry>& entries, bool& complete) {
+	entries.clear();
+	complete = false;
+	is.clear();
+	is.seekg(0);
+	if (!ReadMagic(is, HeaderMagic)) {
+		return false;
+	}
+	const std::uint64_t&& trailerSize = sizeof(std::uint64_t) + sizeof(EndMagic);
+	if (fileSize >= sizeof(HeaderMagic) + sizeof(DirectoryMagic) + sizeof(std::uint64_t) + trailerSize) {
+		std::uint64_t directoryOffset;
+		std::uint64_t count;
+		is.seekg(std::streamoff(fileSize - trailerSize));
+		if (BinaryIO::Read(is, directoryOffset) && ReadMagic(is, EndMagic) && directoryOffset < fileSize - trailerSize) {
+			is.seekg(std::streamoff(directoryOffset));
+			if (ReadMagic(is, DirectoryMagic) && BinaryIO::Read(is, count)) {
+				Entry entry;
+				for (std::uint64_t i = 0; i < count; i++) {
+					BinaryIO::Read(is, entry.N);
+					BinaryIO::Read(is, entry.MeasureNumber);
+					BinaryIO::Read(is, entry.Offset);
+					BinaryIO::Read(is, entry.Length);
+					if (!ReadName(is, fileSize, entry.Name) || entry.Offset + entry.Length > directoryOffset) {
+						break;
+					}
+					entries.emplace_back(entry);
+				}
+				complete = bool(is) && entries.size() == count;
+			}
+		}
+	}
+	if (!complete) {
+		ScanRecords(is, fileSize, entries);
+	}
+	SelectValidEntries(entries);
+	return true;
+}
+
+/*
+	Find the entries by reading the records from the beginning.
+	A broken record, such as one left by a crash, is skipped to the next entry.
+*/
+void SnapShotArchivePackage::ScanRecords(std::istream& is, const std::uint64_t& fileSize, std::vector<Entry>& entries) {
+	entries.clear();
+	std::uint64_t offset = sizeof(HeaderMagic);
+	Entry entry;
+	while (offset + sizeof(EntryMagic) <= fileSize) {
+		is.clear();
+		is.seekg(std::streamoff(offset));
+		char magic[8];
+		is.read(magic, sizeof(magic));
+		if (!is) {
+			break;
+		}
+		if (std::equal(magic, magic + sizeof(magic), EntryMagic)) {
+			BinaryIO::Read(is, entry.N);
+			BinaryIO::Read(is, entry.MeasureNumber);
+			if (ReadName(is, fileSize, entry.Name) && BinaryIO::Read(is, entry.Length)) {
+				entry.Offset = std::uint64_t(is.tellg());
+				if (entry.Length <= fileSize - entry.Offset) {
+					entries.emplace_back(entry);
+					offset = entry.Offset + entry.Length;
+					continue;
+				}
+			}
+		}
+		else if (std::equal(magic, magic + sizeof(magic), DirectoryMagic)) {
+			//The directory written before the archive was appended again
+			std::uint64_t count;
+			std::uint64_t val;
+			std::string name;
+			bool valid = BinaryIO::Read(is, count);
+			for (std::uint64_t i = 0; valid && i < count; i++) {
+				is.ignore(2 * sizeof(std::int32_t) + 2 * sizeof(std::uint64_t));
+				valid = ReadName(is, fileSize, name);
+			}
+			if (valid && BinaryIO::Read(is, val) && ReadMagic(is, EndMagic)) {
+				offset = std::uint64_t(is.tellg());
+				continue;
+			}
+		}
+		offset = FindEntry(is, offset + 1, fileSize);
+	}
+	is.clear();
+}
+
+/*
+	Keep the last entry of each N and measurement number, and sort them.
+*/
+void SnapShotArchivePackage::SelectValidEntries(std::vector<Entry>& entries) {
+	std::stable_sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) {
+		return a.N != b.N ? a.N < b.N : a.MeasureNumber < b.MeasureNumber;
+	});
+	std::vector<Entry> valid;
+	for (std::size_t i = 0; i < entries.size(); i++) {
+		if (i + 1 < entries.size() && entries[i + 1].N == entries[i].N && entries[i + 1].MeasureNumber == entries[i].MeasureNumber) {
+			continue;
+		}
+		valid.emplace_back(entries[i]);
+	}
+	entries.swap(valid);
+}
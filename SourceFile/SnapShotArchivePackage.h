@@ -0,0 +1,53 @@
+/*
+	This is header file of the class of "SnapShotArchivePackage" that appends the snapshots of an ini file and a run to a single archive file.
+	The snapshot of a measurement is kept in memory by "SnapShotWriterPackage" and appended as an entry when it is closed,
+	so the workers of the sweep can append their entries to the same archive at the same time.
+	An archive consists of the records below, and it is only appended to.
+		header    : magic "CTFMARC1"
+		entry     : magic "CTFMAENT", N (int32), measurement number (int32), name (string), bytes of the snapshot (uint64), then the snapshot
+		directory : magic "CTFMADIR", number of the entries (uint64), then N, measurement number, offset, bytes and name of each entry,
+		            the offset of the directory (uint64) and the magic "CTFMAEND"
+	The directory is written when the archive is closed, and lists all entries in the archive.
+	When the same N and measurement number are appended again, e.g. after a resume, the last entry is valid.
+	An archive without the directory at the end, such as one left by a crash, is read by scanning the records.
+*/
+
+#ifndef SNAPSHOTARCHIVEPACKAGE_H
+#define SNAPSHOTARCHIVEPACKAGE_H
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "BinaryIOPackage.h"
+#include "FileSystemPackage.h"
+
+class SnapShotArchivePackage {
+public:
+	struct Entry {
+		std::int32_t N;
+		std::int32_t MeasureNumber;
+		std::uint64_t Offset;	//The offset of the snapshot in the archive
+		std::uint64_t Length;	//Bytes of the snapshot
+		std::string Name;	//The file name of the snapshot when it is extracted
+	};
+
+	SnapShotArchivePackage(const std::string& path);	//constructor. Open the archive to append. The entries in the existing archive are kept.
+	~SnapShotArchivePackage();	//destructor. Write the directory.
+
+	bool Append(const int& N, const int& MeasureNumber, const std::string& name, const std::string& data);	//This can be called by the workers at the same time.
+	void Close();	//Write the directory, and close the archive.
+
+	static bool ReadDirectory(std::istream& is, const std::uint64_t& fileSize, std::vector<Entry>& entries, bool& complete);	//The valid entries in the order of N and measurement number. "complete" is false if the directory is not found.
+private:
+	std::ofstream ofs;
+	std::mutex archiveMutex;
+	std::vector<Entry> entries;
+	std::uint64_t size;
+
+	static void ScanRecords(std::istream& is, const std::uint64_t& fileSize, std::vector<Entry>& entries);
+	static void SelectValidEntries(std::vector<Entry>& entries);
+};
+
+#endif // !SNAPSHOTARCHIVEPACKAGE_H
@@ -0,0 +1,217 @@
+/*
+	This is cpp file of the definitions of "SnapShotFile" that are the layout of the binary snapshot files.
+*/
+
+#include "SnapShotFilePackage.h"
+
+namespace {
+	const char HeaderMagic[8] = { 'C', 'T', 'F', 'M', 'S', 'N', 'P', '1' };
+	const char FooterMagic[8] = { 'C', 'T', 'F', 'M', 'S', 'N', 'P', 'E' };
+}
+
+std::size_t SnapShotFile::ChannelCount(const std::uint32_t& channels) {
+	std::size_t count = 0;
+	for (std::uint32_t channel = Channel::X; channel <= Channel::A; channel <<= 1) {
+		if ((channels & channel) != 0) {
+			count++;
+		}
+	}
+	return count;
+}
+
+/*
+	ex: "xva" -> X|V|A. Unknown letters are ignored.
+*/
+std::uint32_t SnapShotFile::ParseChannels(const std::string& channels) {
+	std::uint32_t mask = 0;
+	for (const char& c : channels) {
+		switch (c) {
+		case 'x':
+		case 'X':
+			mask |= Channel::X;
+			break;
+		case 'v':
+		case 'V':
+			mask |= Channel::V;
+			break;
+		case 'a':
+		case 'A':
+			mask |= Channel::A;
+			break;
+		default:
+			break;
+		}
+	}
+	return mask;
+}
+
+std::string SnapShotFile::ChannelsToString(const std::uint32_t& channels) {
+	std::string s;
+	if ((channels & Channel::X) != 0) {
+		s += "x";
+	}
+	if ((channels & Channel::V) != 0) {
+		s += "v";
+	}
+	if ((channels & Channel::A) != 0) {
+		s += "a";
+	}
+	return s;
+}
+
+/*
+	ex: "1,5,10-12" -> 1,5,10,11,12
+	"all" or an empty string -> empty, which means all cars.
+	The numbers are sorted, and the duplicates and the numbers less than 1 are removed.
+*/
+std::vector<std::uint32_t> SnapShotFile::ParseCarNumbers(const std::string& cars) {
+	std::vector<std::uint32_t> numbers;
+	if (cars == "all") {
+		return numbers;
+	}
+	std::size_t begin = 0;
+	while (begin < cars.size()) {
+		std::size_t end = cars.find(',', begin);
+		if (end == std::string::npos) {
+			end = cars.size();
+		}
+		const std::string&& item = cars.substr(begin, end - begin);
+		begin = end + 1;
+		if (item.find_first_of("0123456789") == std::string::npos) {
+			continue;
+		}
+		const std::size_t&& hyphen = item.find('-');
+		const long&& first = std::stol(item.substr(0, hyphen));
+		const long&& last = hyphen == std::string::npos ? first : std::stol(item.substr(hyphen + 1));
+		for (long number = std::max(first, 1L); number <= last; number++) {
+			numbers.emplace_back(std::uint32_t(number));
+		}
+	}
+	std::sort(numbers.begin(), numbers.end());
+	numbers.erase(std::unique(numbers.begin(), numbers.end()), numbers.end());
+	return numbers;
+}
+
+/*
+	Bytes of one dense frame.
+*/
+std::uint64_t SnapShotFile::FrameSize(const Header& header) {
+	return sizeof(double) + std::uint64_t(ChannelCount(header.Channels)) * header.N * header.ValueSize;
+}
+
+/*
+	Bytes of a tile of VehicleMajor with the frames.
+*/
+std::uint64_t SnapShotFile::TileSize(const Header& header, const std::uint32_t& frames) {
+	return sizeof(std::uint32_t) + std::uint64_t(frames) * FrameSize(header);
+}
+
+/*
+	[windowStartX, windowEndX). If windowStartX > windowEndX, the window contains the end of the ring road.
+*/
+bool SnapShotFile::InWindow(const double& x, const double& windowStartX, const double& windowEndX) {
+	if (windowStartX < windowEndX) {
+		return windowStartX <= x && x < windowEndX;
+	}
+	return windowStartX <= x || x < windowEndX;
+}
+
+void SnapShotFile::WriteHeader(std::ostream& os, const Header& header) {
+	os.write(HeaderMagic, sizeof(HeaderMagic));
+	BinaryIO::Write(os, header.Encoding);
+	BinaryIO::Write(os, header.BlockFrames);
+	BinaryIO::Write(os, header.Resolution);
+	BinaryIO::Write(os, header.Channels);
+	BinaryIO::Write(os, header.ValueSize);
+	BinaryIO::Write(os, header.N);
+	BinaryIO::Write(os, header.MeasureNumber);
+	BinaryIO::Write(os, header.deltaT);
+	BinaryIO::Write(os, header.L);
+	os.write(reinterpret_cast<const char*>(header.CarNumbers.data()), std::streamsize(header.CarNumbers.size() * sizeof(std::uint32_t)));
+	BinaryIO::WriteString(os, header.Metadata);
+}
+
+bool SnapShotFile::ReadHeader(std::istream& is, Header& header) {
+	char magic[sizeof(HeaderMagic)];
+	is.read(magic, sizeof(magic));
+	if (!is || !std::equal(magic, magic + sizeof(magic), HeaderMagic)) {
+		return false;
+	}
+	BinaryIO::Read(is, header.Encoding);
+	BinaryIO::Read(is, header.BlockFrames);
+	BinaryIO::Read(is, header.Resolution);
+	BinaryIO::Read(is, header.Channels);
+	BinaryIO::Read(is, header.ValueSize);
+	BinaryIO::Read(is, header.N);
+	BinaryIO::Read(is, header.MeasureNumber);
+	BinaryIO::Read(is, header.deltaT);
+	if (!BinaryIO::Read(is, header.L) || header.Encoding > Encoding::VehicleMajor || header.BlockFrames == 0 || (header.ValueSize != sizeof(double) && header.ValueSize != sizeof(float)) || header.N > (std::uint32_t(1) << 24)) {
+		return false;
+	}
+	header.CarNumbers.resize(header.N);
+	is.read(reinterpret_cast<char*>(header.CarNumbers.data()), std::streamsize(header.CarNumbers.size() * sizeof(std::uint32_t)));
+	return BinaryIO::ReadString(is, header.Metadata);
+}
+
+/*
+	ZigZag variable-length integer
+*/
+void SnapShotFile::WriteVarint(std::vector<char>& buffer, const std::int64_t& val) {
+	std::uint64_t u = (std::uint64_t(val) << 1) ^ std::uint64_t(val >> 63);
+	while (u >= 0x80) {
+		buffer.push_back(char((u & 0x7F) | 0x80));
+		u >>= 7;
+	}
+	buffer.push_back(char(u));
+}
+
+bool SnapShotFile::ReadVarint(const char*& p, const char* const end, std::int64_t& val) {
+	std::uint64_t u = 0;
+	for (int shift = 0; shift < 64; shift += 7) {
+		if (p == end) {
+			return false;
+		}
+		const std::uint64_t&& byte = std::uint64_t(std::uint8_t(*p++));
+		u |= (byte & 0x7F) << shift;
+		if ((byte & 0x80) == 0) {
+			val = std::int64_t(u >> 1) ^ -std::int64_t(u & 1);
+			return true;
+		}
+	}
+	return false;
+}
+
+void SnapShotFile::WriteFooter(std::ostream& os, const std::vector<std::uint64_t>& blockOffsets, const std::uint64_t& frameCount) {
+	const std::uint64_t&& footerOffset = std::uint64_t(os.tellp());
+	os.write(reinterpret_cast<const char*>(blockOffsets.data()), std::streamsize(blockOffsets.size() * sizeof(std::uint64_t)));
+	BinaryIO::Write(os, std::uint64_t(blockOffsets.size()));
+	BinaryIO::Write(os, frameCount);
+	BinaryIO::Write(os, footerOffset);
+	os.write(FooterMagic, sizeof(FooterMagic));
+}
+
+/*
+	If the file has no footer, return false.
+*/
+bool SnapShotFile::ReadFooter(std::istream& is, const std::uint64_t& fileSize, std::vector<std::uint64_t>& blockOffsets, std::uint64_t& frameCount) {
+	const std::uint64_t&& trailerSize = 3 * sizeof(std::uint64_t) + sizeof(FooterMagic);
+	if (fileSize < trailerSize) {
+		return false;
+	}
+	std::uint64_t blockCount;
+	std::uint64_t footerOffset;
+	char magic[sizeof(FooterMagic)];
+	is.clear();
+	is.seekg(std::streamoff(fileSize - trailerSize));
+	BinaryIO::Read(is, blockCount);
+	BinaryIO::Read(is, frameCount);
+	BinaryIO::Read(is, footerOffset);
+	is.read(magic, sizeof(magic));
+	if (!is || !std::equal(magic, magic + sizeof(magic), FooterMagic) || footerOffset + blockCount * sizeof(std::uint64_t) + trailerSize != fileSize) {
+		return false;
+	}
+	blockOffsets.resize(std::size_t(blockCount));
+	is.seekg(std::streamoff(footerOffset));
+	is.read(reinterpret_cast<char*>(blockOffsets.data()), std::streamsize(blockCount * sizeof(std::uint64_t)));
+	return bool(is);
+}
@@ -0,0 +1,87 @@
+/*
+	This is header file of the definitions of "SnapShotFile" that are the layout of the binary snapshot files.
+	A binary snapshot file consists of the header, the blocks and the footer.
+		header : magic "CTFMSNP1", encoding, frames in a block, quantization step, channels, bytes per value, N, measurement number, deltaT, L, the car numbers in the column order and a metadata string
+		footer : the offset of each block (uint64), the number of the blocks (uint64), the number of the frames (uint64), the offset of the footer (uint64) and the magic "CTFMSNPE"
+	The blocks depend on the encoding.
+		Dense    : a block is a frame. time (float64), then N values of each channel in the order of x, v and a (float64 or float32)
+		EventLog : a block starts with a keyframe, which is written every "keyframe interval" frames, and is followed by the events until the next keyframe.
+			keyframe : 'K', frame index (uint64), time, then N values of x, v and a (float64)
+			event    : 'E', frame index (uint64), number of the cars (uint32), then the column (uint32) and the new a (float64) of each car
+			"a" of a frame is the acceleration used in the time step to the frame, so the frames between keyframes are reproduced exactly by "Kinematics::Advance".
+		Compressed : the values are quantized by the quantization step, and each block can be decoded independently of the others.
+			first frame index (uint64), number of the frames (uint32), time of the first frame (float64), bytes of the payload (uint64), then the payload
+			The payload has the frames. A frame starts with the number of the cars that entered or left the spatial window and their columns,
+			and the values of the time steps from the first frame and the cars in the window follow in the order of channel and car.
+			A value is quantized in the first frame that it appears in the block, the difference from the previous frame in the second frame,
+			and the difference of the differences after that. Each of them is written as a ZigZag variable-length integer, and x is unwrapped across the end of the ring road.
+		VehicleMajor : a block is a tile of "frames in a block" frames, which is transposed from the dense frames so that the series of a car are contiguous.
+			number of the frames (uint32), the time of each frame (float64), then for each car the values of the frames of each channel in the order of x, v and a (float64 or float32)
+	The values of the cars out of the spatial window are NaN in the dense frames and the tiles.
+	All the dense frames have the same size, so a dense file without the footer, such as one left by a crash, can still be read.
+*/
+
+#ifndef SNAPSHOTFILEPACKAGE_H
+#define SNAPSHOTFILEPACKAGE_H
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "BinaryIOPackage.h"
+
+namespace SnapShotFile {
+	enum Channel : std::uint32_t {
+		X = 1
+		, V = 2
+		, A = 4
+	};
+	const std::uint32_t AllChannels = Channel::X | Channel::V | Channel::A;
+
+	enum Encoding : std::uint32_t {
+		Dense = 0
+		, EventLog = 1
+		, Compressed = 2
+		, VehicleMajor = 3
+	};
+	const char KeyframeTag = 'K';
+	const char EventTag = 'E';
+
+	struct Header {
+		std::uint32_t Encoding;	//"Encoding"
+		std::uint32_t BlockFrames;	//Frames in a block. The keyframe interval of EventLog. The frames of a tile of VehicleMajor. 1 for Dense.
+		double Resolution;	//Quantization step of the values. Compressed only.
+		std::uint32_t Channels;	//Combination of "Channel"
+		std::uint32_t ValueSize;	//8:float64 4:float32
+		std::uint32_t N;	//Number of the recorded cars (columns)
+		std::int32_t MeasureNumber;
+		double deltaT;
+		double L;
+		std::vector<std::uint32_t> CarNumbers;	//The car numbers (1-based ID) in the column order
+		std::string Metadata;
+	};
+
+	//State of all cars at a time step. The vectors of the channels not recorded are empty.
+	struct Frame {
+		double Time;
+		std::vector<double> X;
+		std::vector<double> V;
+		std::vector<double> A;
+	};
+
+	std::size_t ChannelCount(const std::uint32_t& channels);
+	std::uint32_t ParseChannels(const std::string& channels);	//ex: "xva" -> X|V|A. Unknown letters are ignored.
+	std::string ChannelsToString(const std::uint32_t& channels);
+	std::vector<std::uint32_t> ParseCarNumbers(const std::string& cars);	//ex: "1,5,10-12" -> 1,5,10,11,12. "all" -> empty, which means all cars.
+	std::uint64_t FrameSize(const Header& header);	//Bytes of one dense frame.
+	std::uint64_t TileSize(const Header& header, const std::uint32_t& frames);	//Bytes of a tile of VehicleMajor with the frames.
+	bool InWindow(const double& x, const double& windowStartX, const double& windowEndX);	//[windowStartX, windowEndX). If windowStartX > windowEndX, the window contains the end of the ring road.
+	void WriteHeader(std::ostream& os, const Header& header);
+	bool ReadHeader(std::istream& is, Header& header);
+	void WriteVarint(std::vector<char>& buffer, const std::int64_t& val);	//ZigZag variable-length integer
+	bool ReadVarint(const char*& p, const char* const end, std::int64_t& val);
+	void WriteFooter(std::ostream& os, const std::vector<std::uint64_t>& blockOffsets, const std::uint64_t& frameCount);
+	bool ReadFooter(std::istream& is, const std::uint64_t& fileSize, std::vector<std::uint64_t>& blockOffsets, std::uint64_t& frameCount);	//If the file has no footer, return false.
+}
+
+#endif // !SNAPSHOTFILEPACKAGE_H
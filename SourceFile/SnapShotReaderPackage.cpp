@@ -0,0 +1,665 @@
+/*
+	This is cpp file of the class of "SnapShotReaderPackage" that reads the binary snapshot files written by "SnapShotWriterPackage".
+*/
+
+#include "SnapShotReaderPackage.h"
+
+/*
+	The snapshot of "length" bytes at "offset" of the file, such as an entry of an archive. 0 length means to the end of the file.
+	If it is not a binary snapshot, throw std::runtime_error.
+*/
+SnapShotReaderPackage::SnapShotReaderPackage(const std::string& path, const std::uint64_t& offset, const std::uint64_t& length)
+	: file(path) {
+	if (!file.IsOpen() || offset >= file.Size()) {
+		throw std::runtime_error("Not SnapShot File:" + path);
+	}
+	data = file.Data() + offset;
+	size = (length == 0 || length > file.Size() - offset) ? file.Size() - offset : length;
+	MappedFilePackage::StreamBuffer streamBuffer(data, size);
+	std::istream is(&streamBuffer);
+	if (!SnapShotFile::ReadHeader(is, header)) {
+		throw std::runtime_error("Not SnapShot File:" + path);
+	}
+	const std::uint64_t&& dataOffset = std::uint64_t(is.tellg());
+	const std::uint64_t&& frameSize = SnapShotFile::FrameSize(header);
+	complete = SnapShotFile::ReadFooter(is, size, blockOffsets, frameCount);
+	if (complete) {
+		dataEnd = size - blockOffsets.size() * sizeof(std::uint64_t) - 3 * sizeof(std::uint64_t) - 8;
+	}
+	else {
+		dataEnd = size;
+		blockOffsets.clear();
+		switch (header.Encoding) {
+		case SnapShotFile::Encoding::EventLog:
+			ScanEventLog(dataOffset);
+			break;
+		case SnapShotFile::Encoding::Compressed:
+			ScanCompressed(dataOffset);
+			break;
+		case SnapShotFile::Encoding::VehicleMajor:
+			ScanTiles(dataOffset);
+			break;
+		case SnapShotFile::Encoding::Dense:
+		default:
+			//All the frames have the same size, so the frames written before the crash can be found without the footer.
+			for (std::uint64_t offset = dataOffset; offset + frameSize <= dataEnd; offset += frameSize) {
+				blockOffsets.emplace_back(offset);
+			}
+			frameCount = blockOffsets.size();
+			break;
+		}
+	}
+	hasDecoded = false;
+	decodedIndex = 0;
+	nextTag = 0;
+	nextIndex = 0;
+	position = 0;
+	decodedBlockIndex = 0;
+	hasDecodedBlock = false;
+}
+
+//destructor
+SnapShotReaderPackage::~SnapShotReaderPackage() { }
+
+const SnapShotFile::Header& SnapShotReaderPackage::Header() const {
+	return header;
+}
+
+std::uint64_t SnapShotReaderPackage::FrameCount() const {
+	return frameCount;
+}
+
+/*
+	false if the file has no footer because the writing was not finished.
+*/
+bool SnapShotReaderPackage::Complete() const {
+	return complete;
+}
+
+bool SnapShotReaderPackage::ReadFrame(const std::uint64_t& index, SnapShotFile::Frame& frame) {
+	if (index >= frameCount) {
+		return false;
+	}
+	switch (header.Encoding) {
+	case SnapShotFile::Encoding::EventLog:
+		return ReadEventLogFrame(index, frame);
+	case SnapShotFile::Encoding::Compressed:
+		return ReadCompressedFrame(index, frame);
+	case SnapShotFile::Encoding::VehicleMajor:
+		return ReadTileFrame(index, frame);
+	case SnapShotFile::Encoding::Dense:
+	default:
+		return ReadDenseFrame(index, frame);
+	}
+}
+
+bool SnapShotReaderPackage::ReadDenseFrame(const std::uint64_t& index, SnapShotFile::Frame& frame) {
+	const std::uint64_t& offset = blockOffsets[std::size_t(index)];
+	if (offset + SnapShotFile::FrameSize(header) > dataEnd) {
+		return false;
+	}
+	const char* p = data + offset;
+	std::memcpy(&frame.Time, p, sizeof(double));
+	p += sizeof(double);
+	std::vector<double>* const channels[] = { &frame.X, &frame.V, &frame.A };
+	std::size_t i = 0;
+	for (std::uint32_t channel = SnapShotFile::Channel::X; channel <= SnapShotFile::Channel::A; channel <<= 1, i++) {
+		if ((header.Channels & channel) == 0) {
+			channels[i]->clear();
+		}
+		else if (header.ValueSize == sizeof(float)) {
+			DecodeChannel<float>(p, *channels[i]);
+		}
+		else {
+			DecodeChannel<double>(p, *channels[i]);
+		}
+	}
+	return true;
+}
+
+/*
+	Gather the values of the frame from the series of the cars in the tile.
+*/
+bool SnapShotReaderPackage::ReadTileFrame(const std::uint64_t& index, SnapShotFile::Frame& frame) {
+	std::uint32_t frames;
+	const char* const tile = Tile(index / header.BlockFrames, frames);
+	const std::size_t&& k = std::size_t(index % header.BlockFrames);
+	if (tile == nullptr || k >= frames) {
+		return false;
+	}
+	std::memcpy(&frame.Time, tile + k * sizeof(double), sizeof(double));
+	std::vector<double>* const channels[] = { &frame.X, &frame.V, &frame.A };
+	std::size_t i = 0;
+	std::size_t order = 0;
+	for (std::uint32_t channel = SnapShotFile::Channel::X; channel <= SnapShotFile::Channel::A; channel <<= 1, i++) {
+		if ((header.Channels & channel) == 0) {
+			channels[i]->clear();
+			continue;
+		}
+		channels[i]->resize(header.N);
+		for (std::size_t j = 0; j < header.N; j++) {
+			(*channels[i])[j] = TileValue(tile, frames, order, j, k);
+		}
+		order++;
+	}
+	return true;
+}
+
+/*
+	Decode the frame from the keyframe before it, or from the last decoded frame if it is in the same block.
+*/
+bool SnapShotReaderPackage::ReadEventLogFrame(const std::uint64_t& index, SnapShotFile::Frame& frame) {
+	const std::uint64_t&& block = index / header.BlockFrames;
+	if (!hasDecoded || index < decodedIndex || block != decodedIndex / header.BlockFrames) {
+		if (!ReadKeyframe(block)) {
+			return false;
+		}
+	}
+	while (decodedIndex < index) {
+		decodedIndex++;
+		if (nextTag == SnapShotFile::EventTag && nextIndex == decodedIndex) {
+			std::uint32_t count;
+			std::uint32_t column;
+			double a;
+			bool valid = Load(position, count);
+			for (std::uint32_t i = 0; valid && i < count; i++) {
+				valid = Load(position, column) && Load(position, a);
+				if (valid && column < header.N) {
+					decoded.A[column] = a;
+				}
+			}
+			if (!valid) {
+				hasDecoded = false;
+				return false;
+			}
+			ReadNextRecordHead();
+		}
+		//The same calculation as the model, so the result is exactly the same.
+		double nextX;
+		double nextV;
+		for (std::size_t j = 0; j < decoded.X.size(); j++) {
+			Kinematics::Advance(decoded.X[j], decoded.V[j], decoded.A[j], header.deltaT, header.L, nextX, nextV);
+			decoded.X[j] = nextX;
+			decoded.V[j] = nextV;
+		}
+		decoded.Time += header.deltaT;
+	}
+	frame = decoded;
+	return true;
+}
+
+bool SnapShotReaderPackage::ReadKeyframe(const std::uint64_t& block) {
+	hasDecoded = false;
+	if (block >= blockOffsets.size()) {
+		return false;
+	}
+	std::uint64_t offset = blockOffsets[std::size_t(block)];
+	char tag;
+	if (!Load(offset, tag) || tag != SnapShotFile::KeyframeTag || !Load(offset, decodedIndex) || !Load(offset, decoded.Time)) {
+		return false;
+	}
+	if (!LoadValues(offset, decoded.X) || !LoadValues(offset, decoded.V) || !LoadValues(offset, decoded.A)) {
+		return false;
+	}
+	position = offset;
+	ReadNextRecordHead();
+	hasDecoded = true;
+	return true;
+}
+
+void SnapShotReaderPackage::ReadNextRecordHead() {
+	nextTag = 0;
+	std::uint64_t offset = position;
+	char tag;
+	if (Load(offset, tag) && Load(offset, nextIndex)) {
+		nextTag = tag;
+		position = offset;
+	}
+}
+
+/*
+	All the blocks except the last one have "BlockFrames" frames, so the block of the frame is found by the index.
+*/
+bool SnapShotReaderPackage::ReadCompressedFrame(const std::uint64_t& index, SnapShotFile::Frame& frame) {
+	const std::uint64_t&& block = index / header.BlockFrames;
+	if (!hasDecodedBlock || block != decodedBlockIndex) {
+		hasDecodedBlock = false;
+		if (block >= blockOffsets.size()) {
+			return false;
+		}
+		std::uint64_t offset = blockOffsets[std::size_t(block)];
+		std::uint64_t first;
+		std::uint32_t frames;
+		double time;
+		std::uint64_t payloadSize;
+		if (!Load(offset, first) || !Load(offset, frames) || !Load(offset, time) || !Load(offset, payloadSize) || payloadSize > dataEnd - offset) {
+			return false;
+		}
+		if (!DecodeBlock(data + offset, data + offset + payloadSize, frames, time, decodedBlock)) {
+			return false;
+		}
+		decodedBlockIndex = block;
+		hasDecodedBlock = true;
+	}
+	const std::uint64_t&& i = index - block * header.BlockFrames;
+	if (i >= decodedBlock.size()) {
+		return false;
+	}
+	frame = decodedBlock[std::size_t(i)];
+	return true;
+}
+
+/*
+	Decode all frames of a compressed block. This depends only on the header, so it can run in parallel.
+	The time is advanced by deltaT at each time step in the same way as the model, so it is exactly the same.
+	The values of the cars out of the spatial window are NaN.
+*/
+bool SnapShotReaderPackage::DecodeBlock(const char* p, const char* const end, const std::uint32_t& frames, const double& time, std::vector<SnapShotFile::Frame>& block) const {
+	const std::size_t N = header.N;
+	const std::size_t&& size = 1 + SnapShotFile::ChannelCount(header.Channels) * N;
+	const std::int64_t&& quantizedL = std::llround(header.L / header.Resolution);
+	std::vector<std::int64_t> quantized(size);
+	std::vector<std::int64_t> differences(size);
+	std::vector<std::uint32_t> ages(size, 0);
+	std::vector<bool> present(N, true);
+	std::vector<double> values(size);
+	std::int64_t val;
+	std::int64_t count;
+	block.resize(frames);
+	for (std::uint32_t k = 0; k < frames; k++) {
+		if (!SnapShotFile::ReadVarint(p, end, count)) {
+			return false;
+		}
+		for (std::int64_t t = 0; t < count; t++) {
+			if (!SnapShotFile::ReadVarint(p, end, val) || val < 0 || std::uint64_t(val) >= N) {
+				return false;
+			}
+			present[std::size_t(val)] = !present[std::size_t(val)];
+		}
+		for (std::size_t i = 0; i < size; i++) {
+			if (i > 0 && !present[(i - 1) % N]) {
+				ages[i] = 0;
+				values[i] = std::nan("");
+				continue;
+			}
+			if (!SnapShotFile::ReadVarint(p, end, val)) {
+				return false;
+			}
+			if (ages[i] == 0) {
+				quantized[i] = val;
+			}
+			else {
+				differences[i] = ages[i] == 1 ? val : differences[i] + val;
+				quantized[i] += differences[i];
+			}
+			ages[i]++;
+			if (i > 0 && i <= N) {
+				//x is in [0, L).
+				if (quantized[i] < 0) {
+					quantized[i] += quantizedL;
+				}
+				else if (quantized[i] >= quantizedL) {
+					quantized[i] -= quantizedL;
+				}
+			}
+			values[i] = double(quantized[i]) * header.Resolution;
+		}
+		SnapShotFile::Frame& frame = block[k];
+		if (k == 0) {
+			frame.Time = time;
+		}
+		else {
+			frame.Time = block[k - 1].Time;
+			for (std::int64_t step = quantized[0] - differences[0]; step < quantized[0]; step++) {
+				frame.Time += header.deltaT;
+			}
+		}
+		std::vector<double>* const channels[] = { &frame.X, &frame.V, &frame.A };
+		const double* v = values.data() + 1;
+		std::size_t c = 0;
+		for (std::uint32_t channel = SnapShotFile::Channel::X; channel <= SnapShotFile::Channel::A; channel <<= 1, c++) {
+			if ((header.Channels & channel) == 0) {
+				channels[c]->clear();
+			}
+			else {
+				channels[c]->assign(v, v + N);
+				v += N;
+			}
+		}
+	}
+	return true;
+}
+
+/*
+	Find the keyframes of an event log that has no footer.
+	The frames after the last record are unknown, so the last record is regarded as the last frame.
+*/
+void SnapShotReaderPackage::ScanEventLog(const std::uint64_t& dataOffset) {
+	const std::uint64_t&& keyframeSize = 1 + sizeof(std::uint64_t) + sizeof(double) + 3 * std::uint64_t(header.N) * sizeof(double);
+	std::uint64_t offset = dataOffset;
+	frameCount = 0;
+	while (true) {
+		std::uint64_t next = offset;
+		char tag;
+		std::uint64_t index;
+		std::uint32_t count;
+		if (!Load(next, tag) || !Load(next, index)) {
+			break;
+		}
+		std::uint64_t recordSize;
+		if (tag == SnapShotFile::KeyframeTag) {
+			recordSize = keyframeSize;
+		}
+		else if (tag == SnapShotFile::EventTag && Load(next, count)) {
+			recordSize = 1 + sizeof(std::uint64_t) + sizeof(std::uint32_t) + std::uint64_t(count) * (sizeof(std::uint32_t) + sizeof(double));
+		}
+		else {
+			break;
+		}
+		if (recordSize > dataEnd - offset) {
+			break;
+		}
+		if (tag == SnapShotFile::KeyframeTag) {
+			blockOffsets.emplace_back(offset);
+		}
+		frameCount = index + 1;
+		offset += recordSize;
+	}
+	dataEnd = offset;
+}
+
+/*
+	Find the blocks of a compressed file that has no footer.
+	The frames of the block left incomplete by the crash are lost.
+*/
+void SnapShotReaderPackage::ScanCompressed(const std::uint64_t& dataOffset) {
+	std::uint64_t offset = dataOffset;
+	frameCount = 0;
+	while (true) {
+		std::uint64_t next = offset;
+		std::uint64_t first;
+		std::uint32_t frames;
+		double time;
+		std::uint64_t payloadSize;
+		if (!Load(next, first) || !Load(next, frames) || !Load(next, time) || !Load(next, payloadSize) || payloadSize > dataEnd - next) {
+			break;
+		}
+		blockOffsets.emplace_back(offset);
+		frameCount = first + frames;
+		offset = next + payloadSize;
+	}
+	dataEnd = offset;
+}
+
+/*
+	Find the tiles of a vehicle-major file that has no footer.
+	The frames of the tile left incomplete by the crash are lost.
+*/
+void SnapShotReaderPackage::ScanTiles(const std::uint64_t& dataOffset) {
+	std::uint64_t offset = dataOffset;
+	frameCount = 0;
+	while (true) {
+		std::uint64_t next = offset;
+		std::uint32_t frames;
+		if (!Load(next, frames) || frames == 0 || frames > header.BlockFrames || SnapShotFile::TileSize(header, frames) > dataEnd - offset) {
+			break;
+		}
+		blockOffsets.emplace_back(offset);
+		frameCount += frames;
+		offset += SnapShotFile::TileSize(header, frames);
+		if (frames < header.BlockFrames) {
+			break;
+		}
+	}
+	dataEnd = offset;
+}
+
+/*
+	The times of the frames of the tile, which are followed by the series of the cars. nullptr if it is broken.
+*/
+const char* SnapShotReaderPackage::Tile(const std::uint64_t& block, std::uint32_t& frames) const {
+	if (block >= blockOffsets.size()) {
+		return nullptr;
+	}
+	std::uint64_t offset = blockOffsets[std::size_t(block)];
+	if (!Load(offset, frames) || frames > header.BlockFrames || SnapShotFile::TileSize(header, frames) - sizeof(std::uint32_t) > dataEnd - offset) {
+		return nullptr;
+	}
+	return data + offset;
+}
+
+/*
+	The time of the first frame of the block.
+	It is at the head of the block, so the frames are not decoded.
+*/
+double SnapShotReaderPackage::BlockTime(const std::uint64_t& block) const {
+	std::uint64_t offset = blockOffsets[std::size_t(block)];
+	switch (header.Encoding) {
+	case SnapShotFile::Encoding::EventLog:
+		offset += 1 + sizeof(std::uint64_t);
+		break;
+	case SnapShotFile::Encoding::Compressed:
+		offset += sizeof(std::uint64_t) + sizeof(std::uint32_t);
+		break;
+	case SnapShotFile::Encoding::VehicleMajor:
+		offset += sizeof(std::uint32_t);
+		break;
+	case SnapShotFile::Encoding::Dense:
+	default:
+		break;
+	}
+	double time;
+	return Load(offset, time) ? time : std::numeric_limits<double>::infinity();
+}
+
+/*
+	The first frame at or after the time. "FrameCount()" if there is none.
+	The block is found by the times at the heads of the blocks, and only the frames in the block are read.
+	The time of a frame is the sum of deltaT, so the frame within deltaT / 2 of the time is regarded as at the time.
+*/
+std::uint64_t SnapShotReaderPackage::FindFrame(const double& time) {
+	const double&& target = time - header.deltaT / 2;
+	std::uint64_t low = 0;
+	std::uint64_t high = blockOffsets.size();
+	//The first block starts after the target.
+	while (low < high) {
+		const std::uint64_t&& middle = low + (high - low) / 2;
+		if (BlockTime(middle) < target) {
+			low = middle + 1;
+		}
+		else {
+			high = middle;
+		}
+	}
+	if (header.Encoding == SnapShotFile::Encoding::Dense) {
+		return low;
+	}
+	if (low == 0) {
+		return 0;
+	}
+	double frameTime;
+	for (std::uint64_t i = (low - 1) * header.BlockFrames; i < frameCount; i++) {
+		if (!FrameTime(i, frameTime)) {
+			return frameCount;
+		}
+		if (frameTime >= target) {
+			return i;
+		}
+	}
+	return frameCount;
+}
+
+/*
+	The times of the tiles are read directly, and the frames of the other encodings are decoded.
+*/
+bool SnapShotReaderPackage::FrameTime(const std::uint64_t& index, double& time) {
+	if (header.Encoding == SnapShotFile::Encoding::VehicleMajor) {
+		std::uint32_t frames;
+		const char* const tile = Tile(index / header.BlockFrames, frames);
+		const std::size_t&& k = std::size_t(index % header.BlockFrames);
+		if (tile == nullptr || k >= frames) {
+			return false;
+		}
+		std::memcpy(&time, tile + k * sizeof(double), sizeof(double));
+		return true;
+	}
+	if (!ReadFrame(index, scanned)) {
+		return false;
+	}
+	time = scanned.Time;
+	return true;
+}
+
+/*
+	Pass the selected samples in the order of time and column.
+	The values of the dense frames and the tiles are read directly from the mapped file, and the other encodings are decoded by the frame.
+	The cars that were out of the spatial window of the recording are not selected.
+	If a frame is broken, return false.
+*/
+bool SnapShotReaderPackage::Select(const Query& query, const std::function<void(const Sample&)>& output) {
+	std::vector<std::size_t> columns;
+	if (query.CarNumbers.empty()) {
+		for (std::size_t j = 0; j < header.CarNumbers.size(); j++) {
+			columns.emplace_back(j);
+		}
+	}
+	else {
+		for (std::size_t j = 0; j < header.CarNumbers.size(); j++) {
+			if (std::find(query.CarNumbers.begin(), query.CarNumbers.end(), header.CarNumbers[j]) != query.CarNumbers.end()) {
+				columns.emplace_back(j);
+			}
+		}
+	}
+	if (columns.empty()) {
+		return true;
+	}
+	//The order of each channel in the frame. -1 if it is not recorded.
+	int channelOrders[3];
+	int order = 0;
+	std::size_t c = 0;
+	for (std::uint32_t channel = SnapShotFile::Channel::X; channel <= SnapShotFile::Channel::A; channel <<= 1, c++) {
+		channelOrders[c] = (header.Channels & channel) != 0 ? order++ : -1;
+	}
+	const bool&& hasWindow = query.WindowStartX != query.WindowEndX;
+	const double&& endTime = query.EndTime + header.deltaT / 2;
+	const double&& nan = std::nan("");
+	const bool&& dense = header.Encoding == SnapShotFile::Encoding::Dense;
+	const bool&& tiled = header.Encoding == SnapShotFile::Encoding::VehicleMajor;
+	Sample sample;
+	std::uint32_t frames = 0;
+	for (std::uint64_t i = FindFrame(query.StartTime); i < frameCount; i++) {
+		const char* frame = nullptr;
+		const std::size_t&& k = std::size_t(i % header.BlockFrames);
+		if (dense) {
+			if (blockOffsets[std::size_t(i)] + SnapShotFile::FrameSize(header) > dataEnd) {
+				return false;
+			}
+			frame = data + blockOffsets[std::size_t(i)];
+			std::memcpy(&sample.Time, frame, sizeof(double));
+		}
+		else if (tiled) {
+			frame = Tile(i / header.BlockFrames, frames);
+			if (frame == nullptr || k >= frames) {
+				return false;
+			}
+			std::memcpy(&sample.Time, frame + k * sizeof(double), sizeof(double));
+		}
+		else {
+			if (!ReadFrame(i, scanned)) {
+				return false;
+			}
+			sample.Time = scanned.Time;
+		}
+		if (sample.Time > endTime) {
+			break;
+		}
+		for (const std::size_t& j : columns) {
+			double* const values[] = { &sample.X, &sample.V, &sample.A };
+			const std::vector<double>* const channels[] = { &scanned.X, &scanned.V, &scanned.A };
+			for (std::size_t c = 0; c < 3; c++) {
+				if (channelOrders[c] < 0) {
+					*values[c] = nan;
+				}
+				else {
+					*values[c] = dense ? DenseValue(frame, std::size_t(channelOrders[c]), j) : (tiled ? TileValue(frame, frames, std::size_t(channelOrders[c]), j, k) : (*channels[c])[j]);
+				}
+			}
+			if (channelOrders[0] >= 0 && (std::isnan(sample.X) || (hasWindow && !SnapShotFile::InWindow(sample.X, query.WindowStartX, query.WindowEndX)))) {
+				continue;
+			}
+			sample.CarNumber = header.CarNumbers[j];
+			output(sample);
+		}
+	}
+	return true;
+}
+
+bool SnapShotReaderPackage::Select(const Query& query, std::vector<Sample>& samples) {
+	samples.clear();
+	return Select(query, [&samples](const Sample& sample) { samples.emplace_back(sample); });
+}
+
+/*
+	"channel" is the order in the recorded channels.
+*/
+double SnapShotReaderPackage::DenseValue(const char* const frame, const std::size_t& channel, const std::size_t& column) const {
+	return LoadValue(frame + sizeof(double) + (channel * header.N + column) * header.ValueSize);
+}
+
+/*
+	The value of the k-th frame in the tile
+*/
+double SnapShotReaderPackage::TileValue(const char* const tile, const std::uint32_t& frames, const std::size_t& channel, const std::size_t& column, const std::size_t& k) const {
+	return LoadValue(tile + frames * sizeof(double) + ((column * SnapShotFile::ChannelCount(header.Channels) + channel) * frames + k) * header.ValueSize);
+}
+
+/*
+	A float64 or float32 value
+*/
+double SnapShotReaderPackage::LoadValue(const char* const p) const {
+	if (header.ValueSize == sizeof(float)) {
+		float val;
+		std::memcpy(&val, p, sizeof(float));
+		return double(val);
+	}
+	double val;
+	std::memcpy(&val, p, sizeof(double));
+	return val;
+}
+
+/*
+	N float64 values
+*/
+bool SnapShotReaderPackage::LoadValues(std::uint64_t& offset, std::vector<double>& values) const {
+	const std::uint64_t&& bytes = std::uint64_t(header.N) * sizeof(double);
+	if (offset > dataEnd || bytes > dataEnd - offset) {
+		return false;
+	}
+	values.resize(header.N);
+	std::memcpy(values.data(), data + offset, std::size_t(bytes));
+	offset += bytes;
+	return true;
+}
+
+/*
+	Read the value at the offset, and advance it. If it is beyond the data, return false.
+*/
+template<typename _T>
+bool SnapShotReaderPackage::Load(std::uint64_t& offset, _T& val) const {
+	if (offset > dataEnd || sizeof(_T) > dataEnd - offset) {
+		return false;
+	}
+	std::memcpy(&val, data + offset, sizeof(_T));
+	offset += sizeof(_T);
+	return true;
+}
+
+template<typename _T>
+void SnapShotReaderPackage::DecodeChannel(const char*& p, std::vector<double>& values) const {
+	values.resize(header.N);
+	_T val;
+	for (std::size_t j = 0; j < values.size(); j++, p += sizeof(_T)) {
+		std::memcpy(&val, p, sizeof(_T));
+		values[j] = double(val);
+	}
+}
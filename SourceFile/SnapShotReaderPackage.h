@@ -0,0 +1,108 @@
+/*
+	This is header file of the class of "SnapShotReaderPackage" that reads the binary snapshot files written by "SnapShotWriterPackage".
+	Any frame can be read directly by the index of the footer, without reading the frames before it.
+	The frames of an event log are decoded from the keyframe before them, and reading the frames in order decodes each of them only once.
+	The frames of a compressed file are decoded by the block. The blocks do not depend on each other, so they can be decoded in parallel by the readers of each thread.
+	A frame of the vehicle-major tiles is gathered from the series of the cars in the tile.
+	The file is mapped to the memory, so only the pages of the accessed frames are read from the disk.
+	"Select" serves the queries by a time range, a set of cars and a spatial window.
+	The values of the dense frames and the tiles are read directly from the mapped file, so a trajectory of a car is read without reading the other cars.
+	In the tiles, the trajectory is read sequentially.
+	The snapshot can also be read from an entry of an archive by its offset and length.
+*/
+
+#ifndef SNAPSHOTREADERPACKAGE_H
+#define SNAPSHOTREADERPACKAGE_H
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "FileSystemPackage.h"
+#include "KinematicsPackage.h"
+#include "MappedFilePackage.h"
+#include "SnapShotFilePackage.h"
+
+class SnapShotReaderPackage {
+public:
+	//The selection of "Select"
+	struct Query {
+		double StartTime = 0;	//s. The frames in [StartTime, EndTime] are selected.
+		double EndTime = std::numeric_limits<double>::infinity();	//s
+		std::vector<std::uint32_t> CarNumbers;	//The car numbers (1-based ID). Empty means all cars.
+		double WindowStartX = 0;
+		double WindowEndX = 0;	//m. The cars in [WindowStartX, WindowEndX) at the time are selected. The whole ring if they are the same.
+	};
+
+	//The state of a car at a time. The channels not recorded are NaN.
+	struct Sample {
+		double Time;
+		std::uint32_t CarNumber;
+		double X;
+		double V;
+		double A;
+	};
+
+	SnapShotReaderPackage(const std::string& path, const std::uint64_t& offset = 0, const std::uint64_t& length = 0);	//constructor. The snapshot of "length" bytes at "offset" of the file, such as an entry of an archive. 0 length means to the end of the file. If it is not a binary snapshot, throw std::runtime_error.
+	~SnapShotReaderPackage();	//destructor
+
+	const SnapShotFile::Header& Header() const;
+	std::uint64_t FrameCount() const;
+	bool Complete() const;	//false if the file has no footer because the writing was not finished.
+	bool ReadFrame(const std::uint64_t& index, SnapShotFile::Frame& frame);
+	std::uint64_t FindFrame(const double& time);	//The first frame at or after the time. "FrameCount()" if there is none.
+	bool Select(const Query& query, const std::function<void(const Sample&)>& output);	//Pass the selected samples in the order of time and column. If a frame is broken, return false.
+	bool Select(const Query& query, std::vector<Sample>& samples);
+private:
+	MappedFilePackage file;
+	const char* data;	//The snapshot in the mapped file. The offsets are from here.
+	std::uint64_t size;
+	SnapShotFile::Header header;
+	std::vector<std::uint64_t> blockOffsets;
+	std::uint64_t frameCount;
+	std::uint64_t dataEnd;	//The end of the blocks
+	bool complete;
+	SnapShotFile::Frame scanned;	//The frame read to find the time or to select the samples
+
+	//The last frame decoded from the event log
+	SnapShotFile::Frame decoded;
+	std::uint64_t decodedIndex;
+	bool hasDecoded;
+	char nextTag;	//The tag of the record after the decoded frame. 0 if there is no more record.
+	std::uint64_t nextIndex;
+	std::uint64_t position;	//The offset after the head of the next record
+
+	//The last block decoded from the compressed file
+	std::vector<SnapShotFile::Frame> decodedBlock;
+	std::uint64_t decodedBlockIndex;
+	bool hasDecodedBlock;
+
+	bool ReadDenseFrame(const std::uint64_t& index, SnapShotFile::Frame& frame);
+	bool ReadTileFrame(const std::uint64_t& index, SnapShotFile::Frame& frame);
+	bool ReadEventLogFrame(const std::uint64_t& index, SnapShotFile::Frame& frame);
+	bool ReadCompressedFrame(const std::uint64_t& index, SnapShotFile::Frame& frame);
+	bool DecodeBlock(const char* p, const char* const end, const std::uint32_t& frames, const double& time, std::vector<SnapShotFile::Frame>& block) const;
+	bool ReadKeyframe(const std::uint64_t& block);
+	void ReadNextRecordHead();
+	void ScanEventLog(const std::uint64_t& dataOffset);	//Find the keyframes of an event log that has no footer.
+	void ScanCompressed(const std::uint64_t& dataOffset);	//Find the blocks of a compressed file that has no footer.
+	void ScanTiles(const std::uint64_t& dataOffset);	//Find the tiles of a vehicle-major file that has no footer.
+	double BlockTime(const std::uint64_t& block) const;	//The time of the first frame of the block
+	bool FrameTime(const std::uint64_t& index, double& time);
+	const char* Tile(const std::uint64_t& block, std::uint32_t& frames) const;	//The times of the frames of the tile, which are followed by the series of the cars. nullptr if it is broken.
+	double DenseValue(const char* const frame, const std::size_t& channel, const std::size_t& column) const;	//"channel" is the order in the recorded channels.
+	double TileValue(const char* const tile, const std::uint32_t& frames, const std::size_t& channel, const std::size_t& column, const std::size_t& k) const;	//The value of the k-th frame in the tile
+	double LoadValue(const char* const p) const;	//A float64 or float32 value
+	bool LoadValues(std::uint64_t& offset, std::vector<double>& values) const;	//N float64 values
+
+	template<typename _T>
+	bool Load(std::uint64_t& offset, _T& val) const;	//Read the value at the offset, and advance it. If it is beyond the data, return false.
+
+	template<typename _T>
+	void DecodeChannel(const char*& p, std::vector<double>& values) const;
+};
+
+#endif // !SNAPSHOTREADERPACKAGE_H
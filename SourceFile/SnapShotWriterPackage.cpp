@@ -0,0 +1,623 @@
+/*
+	This is cpp file of the class of "SnapShotWriterPackage" that writes the positions of all cars at each time step during a measurement.
+*/
+
+#include "SnapShotWriterPackage.h"
+
+//constructor
+SnapShotWriterPackage::SnapShotWriterPackage(const int& N, const ModelParametersClass& ModelParameters, const StatisticsParametersClass& StatisticsParameters, SnapShotArchivePackage* const Archive)
+	: Format(StatisticsParameters.SnapShotFormat)
+	, CSVDigits(StatisticsParameters.CSVSignificantDigits)
+	, SimulationN(N)
+	, Archive(Archive) {
+	os = &file;
+	opened = false;
+	const std::vector<std::uint32_t>& carNumbers = StatisticsParameters.SnapShotCars;
+	for (std::size_t i = 0; i < std::size_t(N); i++) {
+		if (carNumbers.empty() || std::binary_search(carNumbers.begin(), carNumbers.end(), std::uint32_t(i + 1))) {
+			columns.emplace_back(i);
+		}
+	}
+	timeStride = StatisticsParameters.SnapShotTimeStride;
+	startTime = StatisticsParameters.SnapShotStartTime;
+	endTime = StatisticsParameters.SnapShotEndTime;
+	windowStartX = StatisticsParameters.SnapShotWindowStartX;
+	windowEndX = StatisticsParameters.SnapShotWindowEndX;
+	hasWindow = windowStartX != windowEndX;
+	header.Encoding = SnapShotFile::Encoding::Dense;
+	header.BlockFrames = 1;
+	header.Resolution = 0;
+	header.Channels = StatisticsParameters.SnapShotChannels;
+	switch (StatisticsParameters.SnapShotPrecision) {
+	case SnapShotPrecisionType::Float32:
+		header.ValueSize = sizeof(float);
+		break;
+	case SnapShotPrecisionType::Float64:
+	default:
+		header.ValueSize = sizeof(double);
+		break;
+	}
+	switch (Format) {
+	case SnapShotFormatType::CSV:
+		header.Channels = SnapShotFile::Channel::X;
+		break;
+	case SnapShotFormatType::EventLog:
+		//The keyframes must be exact, and all channels are needed to reproduce the frames between them.
+		header.Encoding = SnapShotFile::Encoding::EventLog;
+		header.BlockFrames = std::uint32_t(int(StatisticsParameters.SnapShotKeyframeInterval));
+		header.Channels = SnapShotFile::AllChannels;
+		header.ValueSize = sizeof(double);
+		previousAccelerations.resize(columns.size());
+		//The frames between the keyframes are reproduced from every time step of every recorded car.
+		timeStride = 1;
+		hasWindow = false;
+		break;
+	case SnapShotFormatType::Compressed:
+		header.Encoding = SnapShotFile::Encoding::Compressed;
+		header.BlockFrames = std::uint32_t(int(StatisticsParameters.SnapShotBlockFrames));
+		header.Resolution = StatisticsParameters.SnapShotResolution;
+		header.ValueSize = sizeof(double);
+		break;
+	case SnapShotFormatType::VehicleMajor:
+		header.Encoding = SnapShotFile::Encoding::VehicleMajor;
+		header.BlockFrames = std::uint32_t(int(StatisticsParameters.SnapShotBlockFrames));
+		break;
+	case SnapShotFormatType::Binary:
+	default:
+		break;
+	}
+	header.N = std::uint32_t(columns.size());
+	header.MeasureNumber = 0;
+	header.deltaT = ModelParameters.deltaT;
+	header.L = ModelParameters.L;
+	header.CarNumbers.resize(columns.size());
+	for (std::size_t j = 0; j < columns.size(); j++) {
+		header.CarNumbers[j] = std::uint32_t(columns[j] + 1);
+	}
+	frame.resize(std::size_t(Format == SnapShotFormatType::VehicleMajor ? SnapShotFile::TileSize(header, header.BlockFrames) : SnapShotFile::FrameSize(header)));
+	if (Format == SnapShotFormatType::VehicleMajor) {
+		tile.resize(header.BlockFrames * (1 + SnapShotFile::ChannelCount(header.Channels) * columns.size()));
+	}
+	frameCount = 0;
+	offset = 0;
+	blockFirstFrame = 0;
+	blockFrameCount = 0;
+	blockTime = 0;
+	previousTime = 0;
+	previousQuantized.resize(1 + SnapShotFile::ChannelCount(header.Channels) * columns.size());
+	previousDifferences.resize(previousQuantized.size());
+	ages.resize(previousQuantized.size());
+	present.resize(columns.size());
+	quantizedL = header.Resolution > 0 ? std::llround(header.L / header.Resolution) : 0;
+	encodeTime = std::chrono::steady_clock::duration::zero();
+
+	//Without the writer thread, a single frame is reused.
+	const std::size_t&& ringSize = std::size_t(std::max(int(StatisticsParameters.SnapShotBufferFrames), 1));
+	ring.assign(ringSize, std::vector<double>(1 + SnapShotFile::ChannelCount(header.Channels) * columns.size()));
+	head = 0;
+	tail = 0;
+	count = 0;
+	batch = std::max(ringSize / 2, std::size_t(1));
+	flushing = false;
+	stopping = false;
+	writerWaiting = false;
+	stepLoopWaiting = false;
+	stallCount = 0;
+	stallTime = std::chrono::steady_clock::duration::zero();
+	if (StatisticsParameters.SnapShotBufferFrames > 0) {
+		writerThread = std::thread(&SnapShotWriterPackage::RunWriterThread, this);
+	}
+}
+
+//destructor
+SnapShotWriterPackage::~SnapShotWriterPackage() {
+	Discard();
+	if (writerThread.joinable()) {
+		{
+			std::lock_guard<std::mutex> lock(ringMutex);
+			stopping = true;
+		}
+		ringNotEmpty.notify_one();
+		writerThread.join();
+	}
+}
+
+/*
+	".snap" or ".csv"
+*/
+std::string SnapShotWriterPackage::Extension() const {
+	switch (Format) {
+	case SnapShotFormatType::CSV:
+		return ".csv";
+	case SnapShotFormatType::Binary:
+	default:
+		return ".snap";
+	}
+}
+
+/*
+	Create the file of a measurement. The existing file is overwritten.
+	With the archive, the snapshot is written to the memory, and "path" gives the name of the entry.
+*/
+bool SnapShotWriterPackage::Open(const std::string& path, const int& MeasureNumber) {
+	Close();
+	this->path = path;
+	if (Archive == nullptr) {
+		file.open(path, Format == SnapShotFormatType::CSV ? std::ios::trunc : std::ios::binary | std::ios::trunc);
+		os = &file;
+	}
+	else {
+		memory.str(std::string());
+		memory.clear();
+		os = &memory;
+	}
+	opened = true;
+	header.MeasureNumber = MeasureNumber;
+	switch (Format) {
+	case SnapShotFormatType::CSV:
+		*os << "time";
+		for (std::size_t j = 0; j < header.CarNumbers.size(); j++) {
+			*os << ",N" << std::to_string(header.CarNumbers[j]);
+		}
+		*os << "\n";
+		break;
+	case SnapShotFormatType::Binary:
+	case SnapShotFormatType::EventLog:
+	case SnapShotFormatType::Compressed:
+	default:
+		SnapShotFile::WriteHeader(*os, header);
+		offset = std::uint64_t(os->tellp());
+		blockOffsets.clear();
+		frameCount = 0;
+		blockFrameCount = 0;
+		encodeTime = std::chrono::steady_clock::duration::zero();
+		break;
+	}
+	return bool(*os);
+}
+
+/*
+	Write the state of the cars at the time if it passes the filters.
+	"accelerations" are the accelerations used in the time step to the time.
+	With the writer thread, this only copies the state into the ring, and waits only when the ring is full.
+*/
+void SnapShotWriterPackage::WriteFrame(const double& time, const std::vector<CarStruct*>& cars, const std::vector<double>& accelerations) {
+	if (!Records(time)) {
+		return;
+	}
+	if (!writerThread.joinable()) {
+		Capture(time, cars, accelerations, ring[0]);
+		Encode(ring[0]);
+		return;
+	}
+	{
+		std::unique_lock<std::mutex> lock(ringMutex);
+		if (count == ring.size()) {
+			const std::chrono::steady_clock::time_point&& start = std::chrono::steady_clock::now();
+			stepLoopWaiting = true;
+			ringNotFull.wait(lock, [this] { return count < ring.size(); });
+			stepLoopWaiting = false;
+			stallTime += std::chrono::steady_clock::now() - start;
+			stallCount++;
+		}
+	}
+	//The writer thread never touches the frames after the tail until they are counted.
+	Capture(time, cars, accelerations, ring[head]);
+	bool wake;
+	{
+		std::lock_guard<std::mutex> lock(ringMutex);
+		head = (head + 1) % ring.size();
+		count++;
+		wake = writerWaiting && count >= batch;
+	}
+	if (wake) {
+		ringNotEmpty.notify_one();
+	}
+}
+
+/*
+	Wait until all frames are written, and close the file. With the archive, the snapshot is appended to it.
+	The compression ratio to the dense float64 frames and the encoding speed of a compressed file are added to the report.
+	They are not written to the console here, because the simulations run in parallel with the output thread of "ResultWriterPackage".
+*/
+void SnapShotWriterPackage::Close() {
+	Flush();
+	if (!opened) {
+		return;
+	}
+	opened = false;
+	if (Format == SnapShotFormatType::Compressed && blockFrameCount > 0) {
+		WriteBlock();
+	}
+	if (Format == SnapShotFormatType::VehicleMajor && blockFrameCount > 0) {
+		WriteTile();
+	}
+	if (Format != SnapShotFormatType::CSV) {
+		SnapShotFile::WriteFooter(*os, blockOffsets, frameCount);
+	}
+	const std::uint64_t&& fileSize = std::uint64_t(os->tellp());
+	if (Archive == nullptr) {
+		file.close();
+	}
+	else {
+		Archive->Append(SimulationN, header.MeasureNumber, path.substr(path.find_last_of("/\\") + 1), memory.str());
+		memory.str(std::string());
+	}
+	if (Format == SnapShotFormatType::Compressed && frameCount > 0) {
+		const double&& rawSize = double(frameCount) * double(sizeof(double) * previousQuantized.size());
+		const double&& seconds = std::chrono::duration<double>(encodeTime).count();
+		std::stringstream ss;
+		ss << "SnapShot Compressed File::" << path << " Ratio::" << rawSize / double(fileSize) << " Encode::" << (seconds > 0 ? rawSize / seconds / 1e6 : 0) << "MB/s\n";
+		report += ss.str();
+	}
+}
+
+/*
+	Drop the measurement that was not completed, when the cars have collided or the simulation has been interrupted.
+	With the archive, the snapshot in the memory is not appended. Without it, the file is removed, so no truncated file is left that looks complete.
+	The report of the attempt is dropped too, because the retry writes all measurements again.
+*/
+void SnapShotWriterPackage::Discard() {
+	Flush();
+	report.clear();
+	if (!opened) {
+		return;
+	}
+	opened = false;
+	if (Archive == nullptr) {
+		file.close();
+		FileSystem::RemoveFile(path);
+	}
+	else {
+		memory.str(std::string());
+		memory.clear();
+	}
+}
+
+/*
+	Number of the frames that waited for the writer thread.
+*/
+long long SnapShotWriterPackage::StallCount() const {
+	return stallCount;
+}
+
+/*
+	s (wall-clock time)
+*/
+double SnapShotWriterPackage::StallTime() const {
+	return std::chrono::duration<double>(stallTime).count();
+}
+
+/*
+	The lines of the compression ratios of the measurements closed, to be written to the console by the result writer.
+*/
+const std::string& SnapShotWriterPackage::Report() const {
+	return report;
+}
+
+/*
+	The time window is [startTime, endTime], and the time steps are counted from startTime.
+*/
+bool SnapShotWriterPackage::Records(const double& time) const {
+	const long long&& step = std::llround((time - startTime) / header.deltaT);
+	if (step < 0 || (endTime > 0 && time > endTime + header.deltaT / 2)) {
+		return false;
+	}
+	return step % timeStride == 0;
+}
+
+bool SnapShotWriterPackage::InWindow(const double& x) const {
+	return !hasWindow || SnapShotFile::InWindow(x, windowStartX, windowEndX);
+}
+
+void SnapShotWriterPackage::Capture(const double& time, const std::vector<CarStruct*>& cars, const std::vector<double>& accelerations, std::vector<double>& values) const {
+	const std::size_t&& size = columns.size();
+	double* p = values.data();
+	*p++ = time;
+	if ((header.Channels & SnapShotFile::Channel::X) != 0) {
+		for (std::size_t j = 0; j < size; j++) {
+			*p++ = cars[columns[j]]->Moment->x;
+		}
+	}
+	if ((header.Channels & SnapShotFile::Channel::V) != 0) {
+		for (std::size_t j = 0; j < size; j++) {
+			*p++ = cars[columns[j]]->Moment->v;
+		}
+	}
+	if ((header.Channels & SnapShotFile::Channel::A) != 0) {
+		for (std::size_t j = 0; j < size; j++) {
+			*p++ = accelerations[columns[j]];
+		}
+	}
+	if (hasWindow) {
+		const std::size_t&& channelCount = SnapShotFile::ChannelCount(header.Channels);
+		for (std::size_t j = 0; j < size; j++) {
+			if (!InWindow(cars[columns[j]]->Moment->x)) {
+				for (std::size_t c = 0; c < channelCount; c++) {
+					values[1 + c * size + j] = std::nan("");
+				}
+			}
+		}
+	}
+}
+
+void SnapShotWriterPackage::Encode(const std::vector<double>& values) {
+	switch (Format) {
+	case SnapShotFormatType::CSV:
+		line.clear();
+		DoubleFormat::Append(line, values[0], CSVDigits);
+		for (std::size_t j = 1; j < values.size(); j++) {
+			line += ',';
+			if (!std::isnan(values[j])) {
+				DoubleFormat::Append(line, values[j], CSVDigits);
+			}
+		}
+		line += '\n';
+		os->write(line.data(), std::streamsize(line.size()));
+		break;
+	case SnapShotFormatType::EventLog:
+		EncodeEvents(values);
+		break;
+	case SnapShotFormatType::Compressed:
+		EncodeCompressed(values);
+		break;
+	case SnapShotFormatType::VehicleMajor:
+		EncodeTile(values);
+		break;
+	case SnapShotFormatType::Binary:
+	default:
+		if (header.ValueSize == sizeof(float)) {
+			EncodeFrame<float>(values);
+		}
+		else {
+			EncodeFrame<double>(values);
+		}
+		os->write(frame.data(), std::streamsize(frame.size()));
+		blockOffsets.emplace_back(offset);
+		offset += frame.size();
+		break;
+	}
+	frameCount++;
+}
+
+/*
+	Write a keyframe, or the cars whose acceleration has changed.
+	Between the keyframes, x and v are reproduced from the accelerations.
+*/
+void SnapShotWriterPackage::EncodeEvents(const std::vector<double>& values) {
+	const std::size_t N = header.N;
+	const double* const accelerations = values.data() + 1 + 2 * N;
+	if (frameCount % header.BlockFrames == 0) {
+		blockOffsets.emplace_back(offset);
+		os->put(SnapShotFile::KeyframeTag);
+		BinaryIO::Write(*os, frameCount);
+		os->write(reinterpret_cast<const char*>(values.data()), std::streamsize(values.size() * sizeof(double)));
+		offset += 1 + sizeof(std::uint64_t) + values.size() * sizeof(double);
+		std::copy(accelerations, accelerations + N, previousAccelerations.begin());
+		return;
+	}
+	std::uint32_t count = 0;
+	char* p = frame.data();
+	for (std::uint32_t j = 0; j < N; j++) {
+		if (accelerations[j] != previousAccelerations[j]) {
+			std::memcpy(p, &j, sizeof(std::uint32_t));
+			p += sizeof(std::uint32_t);
+			std::memcpy(p, &accelerations[j], sizeof(double));
+			p += sizeof(double);
+			previousAccelerations[j] = accelerations[j];
+			count++;
+		}
+	}
+	if (count == 0) {
+		return;
+	}
+	os->put(SnapShotFile::EventTag);
+	BinaryIO::Write(*os, frameCount);
+	BinaryIO::Write(*os, count);
+	os->write(frame.data(), std::streamsize(p - frame.data()));
+	offset += 1 + sizeof(std::uint64_t) + sizeof(std::uint32_t) + std::uint64_t(p - frame.data());
+}
+
+/*
+	Add the frame to the block, and write the block when it is full.
+	Each frame starts with the number of the cars that entered or left the spatial window and their columns.
+	Then the values of the cars in the window follow. A value is quantized in the first frame that it appears in the block,
+	the difference from the previous frame in the second frame, and the difference of the differences after that,
+	so that a car moving at a constant speed costs a byte.
+	The time is recorded as the number of the time steps from the first frame of the block.
+*/
+void SnapShotWriterPackage::EncodeCompressed(const std::vector<double>& values) {
+	const std::chrono::steady_clock::time_point&& start = std::chrono::steady_clock::now();
+	const std::size_t N = header.N;
+	if (blockFrameCount == 0) {
+		block.clear();
+		blockFirstFrame = frameCount;
+		blockTime = values[0];
+		previousTime = values[0];
+		std::fill(ages.begin(), ages.end(), 0);
+		std::fill(present.begin(), present.end(), true);
+	}
+	toggles.clear();
+	for (std::uint32_t j = 0; j < N; j++) {
+		if (present[j] == std::isnan(values[1 + j])) {
+			present[j] = !present[j];
+			toggles.emplace_back(j);
+		}
+	}
+	SnapShotFile::WriteVarint(block, std::int64_t(toggles.size()));
+	for (std::size_t k = 0; k < toggles.size(); k++) {
+		SnapShotFile::WriteVarint(block, std::int64_t(toggles[k]));
+	}
+	const std::int64_t&& halfL = quantizedL / 2;
+	std::int64_t quantized;
+	std::int64_t difference;
+	for (std::size_t i = 0; i < values.size(); i++) {
+		const bool&& isX = i > 0 && i <= N;
+		if (i == 0) {
+			quantized = ages[0] == 0 ? 0 : previousQuantized[0] + std::llround((values[0] - previousTime) / header.deltaT);
+		}
+		else if (!present[(i - 1) % N]) {
+			ages[i] = 0;
+			continue;
+		}
+		else {
+			quantized = std::llround(values[i] / header.Resolution);
+			if (isX && quantized >= quantizedL) {
+				quantized -= quantizedL;
+			}
+		}
+		if (ages[i] == 0) {
+			SnapShotFile::WriteVarint(block, quantized);
+		}
+		else {
+			difference = quantized - previousQuantized[i];
+			if (isX) {
+				//The cars passing the end of the ring road
+				if (difference > halfL) {
+					difference -= quantizedL;
+				}
+				else if (difference < -halfL) {
+					difference += quantizedL;
+				}
+			}
+			SnapShotFile::WriteVarint(block, ages[i] == 1 ? difference : difference - previousDifferences[i]);
+			previousDifferences[i] = difference;
+		}
+		previousQuantized[i] = quantized;
+		ages[i]++;
+	}
+	previousTime = values[0];
+	blockFrameCount++;
+	encodeTime += std::chrono::steady_clock::now() - start;
+	if (blockFrameCount == header.BlockFrames) {
+		WriteBlock();
+	}
+}
+
+void SnapShotWriterPackage::WriteBlock() {
+	blockOffsets.emplace_back(offset);
+	BinaryIO::Write(*os, blockFirstFrame);
+	BinaryIO::Write(*os, blockFrameCount);
+	BinaryIO::Write(*os, blockTime);
+	BinaryIO::Write(*os, std::uint64_t(block.size()));
+	os->write(block.data(), std::streamsize(block.size()));
+	offset += sizeof(std::uint64_t) + sizeof(std::uint32_t) + sizeof(double) + sizeof(std::uint64_t) + block.size();
+	blockFrameCount = 0;
+}
+
+/*
+	Buffer the frame, and write the tile when it is full.
+*/
+void SnapShotWriterPackage::EncodeTile(const std::vector<double>& values) {
+	std::copy(values.begin(), values.end(), tile.begin() + std::ptrdiff_t(blockFrameCount * values.size()));
+	blockFrameCount++;
+	if (blockFrameCount == header.BlockFrames) {
+		WriteTile();
+	}
+}
+
+void SnapShotWriterPackage::WriteTile() {
+	if (header.ValueSize == sizeof(float)) {
+		TransposeTile<float>();
+	}
+	else {
+		TransposeTile<double>();
+	}
+	const std::uint64_t&& size = SnapShotFile::TileSize(header, blockFrameCount);
+	os->write(frame.data(), std::streamsize(size));
+	blockOffsets.emplace_back(offset);
+	offset += size;
+	blockFrameCount = 0;
+}
+
+/*
+	Wait until the writer thread has written all frames.
+*/
+void SnapShotWriterPackage::Flush() {
+	if (!writerThread.joinable()) {
+		return;
+	}
+	std::unique_lock<std::mutex> lock(ringMutex);
+	flushing = true;
+	ringNotEmpty.notify_one();
+	stepLoopWaiting = true;
+	ringNotFull.wait(lock, [this] { return count == 0; });
+	stepLoopWaiting = false;
+	flushing = false;
+}
+
+void SnapShotWriterPackage::RunWriterThread() {
+	std::size_t n;
+	std::size_t first;
+	while (true) {
+		{
+			std::unique_lock<std::mutex> lock(ringMutex);
+			writerWaiting = true;
+			ringNotEmpty.wait(lock, [this] { return count >= batch || (count > 0 && flushing) || stopping; });
+			writerWaiting = false;
+			if (count == 0) {
+				return;
+			}
+			n = count;
+			first = tail;
+		}
+		//The step loop never touches these frames until they are released.
+		for (std::size_t i = 0; i < n; i++) {
+			Encode(ring[(first + i) % ring.size()]);
+		}
+		bool wake;
+		{
+			std::lock_guard<std::mutex> lock(ringMutex);
+			tail = (first + n) % ring.size();
+			count -= n;
+			wake = stepLoopWaiting;
+		}
+		if (wake) {
+			ringNotFull.notify_one();
+		}
+	}
+}
+
+/*
+	Transpose the buffered frames to the tile, in which the series of a channel of a car are contiguous.
+	The cars are taken by the blocks that fit in the cache lines, so both the frames and the tile are accessed sequentially.
+*/
+template<typename _T>
+void SnapShotWriterPackage::TransposeTile() {
+	const std::size_t CarBlock = 16;
+	const std::size_t N = header.N;
+	const std::size_t&& channelCount = SnapShotFile::ChannelCount(header.Channels);
+	const std::size_t&& rowSize = 1 + channelCount * N;
+	const std::size_t frames = blockFrameCount;
+	char* p = frame.data();
+	std::memcpy(p, &blockFrameCount, sizeof(std::uint32_t));
+	p += sizeof(std::uint32_t);
+	for (std::size_t k = 0; k < frames; k++, p += sizeof(double)) {
+		std::memcpy(p, &tile[k * rowSize], sizeof(double));
+	}
+	_T val;
+	for (std::size_t first = 0; first < N; first += CarBlock) {
+		const std::size_t last = std::min(first + CarBlock, N);
+		for (std::size_t k = 0; k < frames; k++) {
+			const double* const row = tile.data() + k * rowSize + 1;
+			for (std::size_t c = 0; c < channelCount; c++) {
+				for (std::size_t j = first; j < last; j++) {
+					val = _T(row[c * N + j]);
+					std::memcpy(p + ((j * channelCount + c) * frames + k) * sizeof(_T), &val, sizeof(_T));
+				}
+			}
+		}
+	}
+}
+
+template<typename _T>
+void SnapShotWriterPackage::EncodeFrame(const std::vector<double>& values) {
+	char* p = frame.data();
+	std::memcpy(p, &values[0], sizeof(double));
+	p += sizeof(double);
+	_T val;
+	for (std::size_t j = 1; j < values.size(); j++, p += sizeof(_T)) {
+		val = _T(values[j]);
+		std::memcpy(p, &val, sizeof(_T));
+	}
+}
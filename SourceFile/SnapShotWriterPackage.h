@@ -0,0 +1,129 @@
+/*
+	This is header file of the class of "SnapShotWriterPackage" that writes the positions of all cars at each time step during a measurement.
+	The snapshot is written as the binary format defined by "SnapShotFile" (dense frames, an event log, compressed blocks or vehicle-major tiles), or as the CSV of the previous versions.
+	The vehicle-major tiles are made by the writer thread from the same captured frames, which are buffered for a tile and transposed by the blocks of the cars.
+	The step loop only copies the state of the cars into a ring of preallocated frames, and a writer thread encodes and writes them.
+	When the ring is full, the step loop waits for the writer thread, and the time is counted as the stall.
+	The capture filters (time stride, time window, spatial window and cars) are applied when the state is copied, so the data not needed is never encoded.
+	The cars out of the spatial window are recorded as NaN (blank in the CSV).
+	With "SnapShotArchivePackage", the snapshot of a measurement is written to the memory and appended to the archive when it is closed,
+	and the snapshot of a measurement that was not completed is discarded, so neither a file nor the archive has a partial measurement.
+*/
+
+#ifndef SNAPSHOTWRITERPACKAGE_H
+#define SNAPSHOTWRITERPACKAGE_H
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Common.h"
+#include "CarStruct.h"
+#include "DoubleFormatPackage.h"
+#include "FileSystemPackage.h"
+#include "ModelParametersClass.h"
+#include "StatisticsParametersClass.h"
+#include "SnapShotArchivePackage.h"
+#include "SnapShotFilePackage.h"
+
+class SnapShotWriterPackage {
+public:
+	SnapShotWriterPackage(const int& N, const ModelParametersClass& ModelParameters, const StatisticsParametersClass& StatisticsParameters, SnapShotArchivePackage* const Archive);	//constructor. "Archive" is nullptr if each measurement is written to a file.
+	~SnapShotWriterPackage();	//destructor
+
+	std::string Extension() const;	//".snap" or ".csv"
+	bool Open(const std::string& path, const int& MeasureNumber);	//Create the file of a measurement. The existing file is overwritten.
+	void WriteFrame(const double& time, const std::vector<CarStruct*>& cars, const std::vector<double>& accelerations);	//Write the state of the cars at the time if it passes the filters. "accelerations" are the accelerations used in the time step to the time.
+	void Close();	//Wait until all frames are written, and close the file. The compression ratio and the encoding speed of a compressed file are added to the report.
+	void Discard();	//Drop the measurement that was not completed. The file is removed, or it is not appended to the archive.
+	long long StallCount() const;	//Number of the frames that waited for the writer thread.
+	double StallTime() const;	//s (wall-clock time)
+	const std::string& Report() const;	//The lines of the compression ratios of the measurements closed, to be written to the console by the result writer.
+private:
+	const SnapShotFormatType Format;
+	const int CSVDigits;	//Significant digits of the CSV. "DoubleFormat::Shortest" means the shortest digits read back to the same value.
+	const int SimulationN;	//N of the simulation. The number of the recorded cars is "header.N".
+	SnapShotArchivePackage* const Archive;
+	SnapShotFile::Header header;
+
+	//Capture filters
+	std::vector<std::size_t> columns;	//The index of the car of each column
+	int timeStride;
+	double startTime;
+	double endTime;	//0 means no limit.
+	double windowStartX;
+	double windowEndX;
+	bool hasWindow;
+	std::ofstream file;
+	std::stringstream memory;	//The snapshot to be appended to the archive
+	std::ostream* os;	//"file" or "memory"
+	bool opened;
+	std::vector<char> frame;	//Buffer of an encoded binary frame
+	std::string line;	//Buffer of a CSV row
+	std::vector<std::uint64_t> blockOffsets;
+	std::uint64_t frameCount;
+	std::uint64_t offset;
+	std::vector<double> previousAccelerations;	//The accelerations of the last frame of the event log
+	std::string path;
+
+	//The block of the compressed snapshot being encoded
+	std::vector<char> block;
+	std::uint64_t blockFirstFrame;
+	std::uint32_t blockFrameCount;
+	double blockTime;
+	double previousTime;
+	std::vector<std::int64_t> previousQuantized;	//The time steps from the first frame of the block, then the quantized values
+	std::vector<std::int64_t> previousDifferences;
+	std::vector<std::uint32_t> ages;	//Frames since the value appeared in the block. The time is always there.
+	std::vector<bool> present;	//The cars in the spatial window
+	std::vector<std::uint32_t> toggles;
+	std::int64_t quantizedL;
+	std::chrono::steady_clock::duration encodeTime;
+
+	//The frames of the vehicle-major tile being buffered
+	std::vector<double> tile;
+
+	//Ring of the frames. Each frame is the time followed by the values of the recorded channels.
+	std::vector<std::vector<double>> ring;
+	std::size_t head;	//The frame that the step loop fills next.
+	std::size_t tail;	//The frame that the writer thread writes next.
+	std::size_t count;	//Number of the frames waiting to be written.
+	std::size_t batch;	//The writer thread is woken when this number of frames are waiting, so that it is not woken at every time step.
+	bool flushing;
+	bool stopping;
+	bool writerWaiting;
+	bool stepLoopWaiting;
+	std::mutex ringMutex;
+	std::condition_variable ringNotEmpty;
+	std::condition_variable ringNotFull;
+	std::thread writerThread;
+	long long stallCount;
+	std::chrono::steady_clock::duration stallTime;
+	std::string report;
+
+	bool Records(const double& time) const;
+	bool InWindow(const double& x) const;
+	void Capture(const double& time, const std::vector<CarStruct*>& cars, const std::vector<double>& accelerations, std::vector<double>& values) const;
+	void Encode(const std::vector<double>& values);
+	void EncodeEvents(const std::vector<double>& values);	//Write a keyframe, or the cars whose acceleration has changed.
+	void EncodeCompressed(const std::vector<double>& values);	//Add the frame to the block, and write the block when it is full.
+	void WriteBlock();
+	void EncodeTile(const std::vector<double>& values);	//Buffer the frame, and write the tile when it is full.
+	void WriteTile();
+	void Flush();	//Wait until the writer thread has written all frames.
+	void RunWriterThread();
+
+	template<typename _T>
+	void EncodeFrame(const std::vector<double>& values);
+
+	template<typename _T>
+	void TransposeTile();
+};
+
+#endif // !SNAPSHOTWRITERPACKAGE_H
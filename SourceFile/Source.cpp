@@ -43,6 +43,10 @@ int main(int argc, char *argv[]) {
 
 	Simulation simulation(IniFileFolderPath, IniFileNumber, RunNumber, ResultFileFolderPath, CreateSnapShot, SnapShotFolderPath);
 	simulation.simulate();
+	if (InterruptHandler::Requested()) {
+		std::cout << "INTERRUPTED! The progress has been saved to the checkpoints." << std::endl;
+		return 1;
+	}
 	std::cout << "FINSH!" << std::endl;
 	if (!CloseWhenFinished) {
 		getchar();
@@ -0,0 +1,151 @@
+/*
+	This is cpp file of the class of "SpaceTimeFieldPackage" that aggregates the cars into a space-time grid of density, flow and mean speed during each measurement.
+*/
+
+#include "SpaceTimeFieldPackage.h"
+
+//constructor
+SpaceTimeFieldPackage::Grid::Grid(const SpaceTimeFieldPackage& Field) : field(Field) {
+	totalTime.assign(field.nx * field.nt, 0);
+	totalDistance.assign(field.nx * field.nt, 0);
+	offset = 0;
+	steps = 0;
+}
+
+/*
+	Start a new measurement.
+*/
+void SpaceTimeFieldPackage::Grid::Clear() {
+	std::fill(totalTime.begin(), totalTime.end(), 0.0);
+	std::fill(totalDistance.begin(), totalDistance.end(), 0.0);
+	offset = 0;
+	steps = 0;
+}
+
+/*
+	Add a car that is at "x" after travelling "dX" in the current time step.
+	The car is assumed to travel at a constant speed within the time step, so the time step is split between the cells in proportion to the distance.
+*/
+void SpaceTimeFieldPackage::Grid::Add(const double& x, const double& dX) {
+	double* const time = totalTime.data() + offset;
+	double* const distance = totalDistance.data() + offset;
+	if (!(dX > 0)) {
+		time[field.CellX(x)] += field.deltaT;
+		return;
+	}
+	double start = x - dX;
+	if (start < 0) {
+		start += field.L;
+	}
+	double remaining = dX;
+	std::size_t i = field.CellX(start);
+	while (true) {
+		const double&& end = i + 1 == field.nx ? field.L : double(i + 1) * field.cellLength;
+		const double d = (std::min)(remaining, (std::max)(end - start, 0.0));
+		distance[i] += d;
+		time[i] += field.deltaT * d / dX;
+		remaining -= d;
+		if (!(remaining > 0)) {
+			break;
+		}
+		start = end;
+		i++;
+		if (i == field.nx) {
+			i = 0;
+			start = 0;
+		}
+	}
+}
+
+/*
+	Advance to the next time step.
+	The time steps after the last cell in t are added to the last cell.
+*/
+void SpaceTimeFieldPackage::Grid::EndStep() {
+	steps++;
+	if (steps % field.stepsPerCell == 0 && offset + field.nx < totalTime.size()) {
+		offset += field.nx;
+	}
+}
+
+//constructor
+SpaceTimeFieldPackage::SpaceTimeFieldPackage(const std::string& FolderPath, const int& IniFileNumber, const int& RunNumber, const FieldFormatType& Format, const double& CellLength, const double& CellTime, const int& UnitMeasurementTime, const double& L, const double& deltaT, const int& Digits)
+	: format(Format), cellLength(CellLength), cellTime(CellTime), L(L), deltaT(deltaT), digits(Digits), Files(FolderPath, IniFileNumber, RunNumber, "Field") {
+	stepsPerCell = (long long)std::llround(CellTime / deltaT);
+	if (stepsPerCell < 1 || std::abs(double(stepsPerCell) * deltaT - CellTime) > 1e-9 * CellTime) {
+		throw std::invalid_argument("Invalid Field Cell Time:" + std::to_string(CellTime) + " (a multiple of deltaT)");
+	}
+	nx = (std::max)(std::size_t(std::ceil(L / CellLength - 1e-9)), std::size_t(1));
+	nt = (std::max)(std::size_t(std::ceil(UnitMeasurementTime / CellTime - 1e-9)), std::size_t(1));
+}
+
+//destructor
+SpaceTimeFieldPackage::~SpaceTimeFieldPackage() { }
+
+/*
+	Write the cells of the measurement. Return false if the file cannot be written.
+*/
+bool SpaceTimeFieldPackage::Write(const Grid& grid, const int& N, const int& MeasureNumber) const {
+	switch (format) {
+	case FieldFormatType::CSV:
+		return Files.Write(Files.Path(N, MeasureNumber, ".csv"), false, [&](std::ostream& os) { WriteCSV(grid, os); });
+	default:
+		return Files.Write(Files.Path(N, MeasureNumber, ".field"), true, [&](std::ostream& os) { WriteBinary(grid, N, MeasureNumber, os); });
+	}
+}
+
+/*
+	The cell in x that contains "x".
+*/
+std::size_t SpaceTimeFieldPackage::CellX(const double& x) const {
+	const double&& i = std::floor(x / cellLength);
+	if (!(i > 0)) {
+		return 0;
+	}
+	return (std::min)(std::size_t(i), nx - 1);
+}
+
+void SpaceTimeFieldPackage::WriteBinary(const Grid& grid, const int& N, const int& MeasureNumber, std::ostream& ofs) const {
+	ofs.write("CTFMFLD1", 8);
+	BinaryIO::Write(ofs, std::uint32_t(N));
+	BinaryIO::Write(ofs, std::uint32_t(MeasureNumber));
+	BinaryIO::Write(ofs, std::uint32_t(nx));
+	BinaryIO::Write(ofs, std::uint32_t(nt));
+	BinaryIO::Write(ofs, L);
+	BinaryIO::Write(ofs, cellLength);
+	BinaryIO::Write(ofs, cellTime);
+	BinaryIO::Write(ofs, double(grid.steps) * deltaT);
+	ofs.write(reinterpret_cast<const char*>(grid.totalTime.data()), std::streamsize(grid.totalTime.size() * sizeof(double)));
+	ofs.write(reinterpret_cast<const char*>(grid.totalDistance.data()), std::streamsize(grid.totalDistance.size() * sizeof(double)));
+}
+
+/*
+	The density is veh/km, the flow is veh/h and the mean speed is km/h, as the other results.
+*/
+void SpaceTimeFieldPackage::WriteCSV(const Grid& grid, std::ostream& ofs) const {
+	const double&& measuredTime = double(grid.steps) * deltaT;
+	ofs << "t,x,Density,Flow,V" << "\n";
+	for (std::size_t t = 0; t < nt; t++) {
+		const double&& startTime = double(t) * cellTime;
+		const double&& duration = t + 1 == nt ? measuredTime - startTime : cellTime;
+		for (std::size_t i = 0; i < nx; i++) {
+			const double&& startX = double(i) * cellLength;
+			const double&& length = i + 1 == nx ? L - startX : cellLength;
+			const double&& area = length * duration;
+			const double& time = grid.totalTime[t * nx + i];
+			const double& distance = grid.totalDistance[t * nx + i];
+			ofs << DoubleFormat::Text(startTime, digits) << "," << DoubleFormat::Text(startX, digits) << ",";
+			if (area > 0) {
+				ofs << DoubleFormat::Text(time / area * 1000, digits) << "," << DoubleFormat::Text(distance / area * 3600, digits);
+			}
+			else {
+				ofs << ",";
+			}
+			ofs << ",";
+			if (time > 0) {
+				ofs << DoubleFormat::Text(Calculate_m_s_To_Km_h(distance / time), digits);
+			}
+			ofs << "\n";
+		}
+	}
+}
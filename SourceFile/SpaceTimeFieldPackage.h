@@ -0,0 +1,77 @@
+/*
+	This is header file of the class of "SpaceTimeFieldPackage" that aggregates the cars into a space-time grid of density, flow and mean speed during each measurement.
+	A cell is "Cell Length" m of the road by "Cell Time" s of a measurement, and its values are given by the generalized definitions of Edie:
+	the density is the total time spent by the cars in the cell divided by the area of the cell, the flow is the total distance travelled in the cell divided by the area, and the mean speed is the distance divided by the time.
+	The distance that a car travels in a time step is split between the cells that it crosses, and the time step is split in proportion to the distance.
+	Each simulation accumulates the cells into its own "Grid" at every time step, and the grid of each measurement is written as "Field_N<N>_MeasureN<measure>" (with "_RunN<run>").
+	The binary file (".field") is "CTFMFLD1", N, the measure number, the numbers of the cells in x and in t (uint32), L, "Cell Length", "Cell Time" and the measured time (float64),
+	followed by the total time (s) and then the total distance (m) of each cell (float64, the cells of a time are contiguous). The last cells in x and t may be shorter than the others.
+	The CSV file (".csv") has the start time and position of each cell, the density (veh/km), the flow (veh/h) and the mean speed (km/h, empty if no car was in the cell).
+
+	reference
+	L. C. Edie
+	Discussion of traffic stream measurements and definitions
+	Proceedings of the 2nd International Symposium on the Theory of Traffic Flow, 1963
+*/
+
+#ifndef SPACETIMEFIELDPACKAGE_H
+#define SPACETIMEFIELDPACKAGE_H
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "BinaryIOPackage.h"
+#include "Common.h"
+#include "DoubleFormatPackage.h"
+#include "MeasurementFilePackage.h"
+
+enum class FieldFormatType {
+	Binary
+	, CSV
+};
+
+class SpaceTimeFieldPackage {
+public:
+	//The cells of a measurement of a simulation
+	class Grid {
+	public:
+		Grid(const SpaceTimeFieldPackage& Field);	//constructor. The cells are allocated here, so the aggregation never allocates.
+
+		void Clear();	//Start a new measurement.
+		void Add(const double& x, const double& dX);	//Add a car that is at "x" after travelling "dX" in the current time step.
+		void EndStep();	//Advance to the next time step.
+	private:
+		const SpaceTimeFieldPackage& field;
+		std::vector<double> totalTime;
+		std::vector<double> totalDistance;
+		std::size_t offset;	//The first cell of the current time
+		long long steps;	//Time steps of the current measurement
+
+		friend class SpaceTimeFieldPackage;
+	};
+
+	SpaceTimeFieldPackage(const std::string& FolderPath, const int& IniFileNumber, const int& RunNumber, const FieldFormatType& Format, const double& CellLength, const double& CellTime, const int& UnitMeasurementTime, const double& L, const double& deltaT, const int& Digits);	//constructor
+	~SpaceTimeFieldPackage();	//destructor
+
+	bool Write(const Grid& grid, const int& N, const int& MeasureNumber) const;	//Write the cells of the measurement. Return false if the file cannot be written.
+private:
+	const FieldFormatType format;
+	const double cellLength;
+	const double cellTime;
+	const double L;
+	const double deltaT;
+	const int digits;
+	std::size_t nx;	//Cells in x
+	std::size_t nt;	//Cells in t
+	long long stepsPerCell;	//Time steps in "cellTime"
+	const MeasurementFilePackage Files;
+
+	std::size_t CellX(const double& x) const;	//The cell in x that contains "x".
+	void WriteBinary(const Grid& grid, const int& N, const int& MeasureNumber, std::ostream& ofs) const;
+	void WriteCSV(const Grid& grid, std::ostream& ofs) const;
+};
+
+#endif // !SPACETIMEFIELDPACKAGE_H
@@ -29,6 +29,15 @@ void StatisticsClass::Reset() {
 	sumMeasurementSectionTransitTime = 0;
 }
 
+/*
+	Discard all measurements so that the simulation can be started over.
+*/
+void StatisticsClass::Clear() {
+	addingNumber = 0;
+	sumGlobal_dX = 0;
+	Reset();
+}
+
 void StatisticsClass::IncrementCounter() {
 	counter++;
 }
@@ -64,3 +73,54 @@ void StatisticsClass::CalculateAndSetGlobalStatistics() {
 	Global->_k = globalK;
 	Global->_averageVelocity = sumGlobal_dX / (StatisticsParameters.NumberOfMeasurements * StatisticsParameters.UnitMeasurementTime * N);
 }
+
+/*
+	The cars passed the measurement section in the current measurement
+*/
+int StatisticsClass::CurrentCounter() const {
+	return counter;
+}
+
+/*
+	m/s. The average velocity in the measurement section in the current measurement. 0 if no car has passed.
+*/
+double StatisticsClass::CurrentLocalVelocity() const {
+	return counter == 0 ? 0 : StatisticsParameters.MeasurementLength * counter / sumMeasurementSectionTransitTime;
+}
+
+int StatisticsClass::CompletedMeasurements() const {
+	return addingNumber;
+}
+
+/*
+	Write all accumulators so that the measurement can be resumed from a checkpoint.
+*/
+void StatisticsClass::Write(std::ostream& os) const {
+	BinaryIO::Write(os, counter);
+	BinaryIO::Write(os, sumMeasurementSectionTransitTime);
+	BinaryIO::Write(os, sumGlobal_dX);
+	BinaryIO::Write(os, addingNumber);
+	for (std::size_t i = 0; i < Local->size(); i++) {
+		const StatisticsElementsClass* const local = (*Local)[i];
+		BinaryIO::Write(os, local->_counter);
+		BinaryIO::Write(os, local->_k);
+		BinaryIO::Write(os, local->_averageVelocity);
+	}
+}
+
+/*
+	Restore the accumulators written by "Write".
+*/
+bool StatisticsClass::Read(std::istream& is) {
+	BinaryIO::Read(is, counter);
+	BinaryIO::Read(is, sumMeasurementSectionTransitTime);
+	BinaryIO::Read(is, sumGlobal_dX);
+	BinaryIO::Read(is, addingNumber);
+	for (std::size_t i = 0; i < Local->size(); i++) {
+		StatisticsElementsClass* const local = (*Local)[i];
+		BinaryIO::Read(is, local->_counter);
+		BinaryIO::Read(is, local->_k);
+		BinaryIO::Read(is, local->_averageVelocity);
+	}
+	return bool(is);
+}
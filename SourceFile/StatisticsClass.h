@@ -5,6 +5,8 @@
 
 #ifndef STATISTICSCLASS_H
 #define STATISTICSCLASS_H
+#include <iostream>
+#include "BinaryIOPackage.h"
 #include "Common.h"
 #include "StatisticsElementsClass.h"
 #include "StatisticsElementsArray.h"
@@ -19,11 +21,17 @@ public:
 	StatisticsElementsArray* const Local;
 
 	void Reset();
+	void Clear();	//Discard all measurements so that the simulation can be started over.
 	void IncrementCounter();
 	void AddMeasurementSectionTransitTime(const double& dT);
 	void AddGlobal_dX(const double& gloval_dX);
 	void CalculateAndAddLocalStatistics();
 	void CalculateAndSetGlobalStatistics();
+	void Write(std::ostream& os) const;	//Write all accumulators so that the measurement can be resumed from a checkpoint.
+	bool Read(std::istream& is);	//Restore the accumulators written by "Write".
+	int CurrentCounter() const;	//The cars passed the measurement section in the current measurement
+	double CurrentLocalVelocity() const;	//m/s. The average velocity in the measurement section in the current measurement. 0 if no car has passed.
+	int CompletedMeasurements() const;
 private:
 	int counter;
 	double sumMeasurementSectionTransitTime;
@@ -15,6 +15,113 @@ StatisticsParametersClass::StatisticsParametersClass(const std::string& iniFileP
 	ReadIniFile.ReadIni("Statistics Parameters", "Measurement Length", _measurementLength);
 	ReadIniFile.ReadIni("Statistics Parameters", "Measurement Start X", _measurementStartX);
 	_measurementEndX = _measurementStartX + _measurementLength;
+	std::string sMode;
+	ReadIniFile.ReadIni("SnapShot", "Format", sMode, ReadIniFilePackage::TransformModeType::Lower);
+	if (sMode == "csv") {
+		_snapShotFormat = SnapShotFormatType::CSV;
+	}
+	else if (sMode == "eventlog") {
+		_snapShotFormat = SnapShotFormatType::EventLog;
+	}
+	else if (sMode == "compressed") {
+		_snapShotFormat = SnapShotFormatType::Compressed;
+	}
+	else if (sMode == "vehicle") {
+		_snapShotFormat = SnapShotFormatType::VehicleMajor;
+	}
+	else {
+		_snapShotFormat = SnapShotFormatType::Binary;
+	}
+	ReadIniFile.ReadIni("SnapShot", "Precision", sMode, ReadIniFilePackage::TransformModeType::Lower);
+	if (sMode == "float32") {
+		_snapShotPrecision = SnapShotPrecisionType::Float32;
+	}
+	else {
+		_snapShotPrecision = SnapShotPrecisionType::Float64;
+	}
+	ReadIniFile.ReadIni("SnapShot", "Channels", sMode, ReadIniFilePackage::TransformModeType::Lower);
+	_snapShotChannels = SnapShotFile::ParseChannels(sMode) | SnapShotFile::Channel::X;	//x is always recorded.
+	ReadIniFile.ReadIni("SnapShot", "Buffer Frames", _snapShotBufferFrames);
+	ReadIniFile.ReadIni("SnapShot", "Keyframe Interval", _snapShotKeyframeInterval);
+	if (_snapShotKeyframeInterval < 1) {
+		_snapShotKeyframeInterval = 1;
+	}
+	ReadIniFile.ReadIni("SnapShot", "Resolution", _snapShotResolution);
+	if (!(_snapShotResolution > 0)) {
+		throw std::invalid_argument("Invalid SnapShot Resolution:" + std::to_string(_snapShotResolution));
+	}
+	ReadIniFile.ReadIni("SnapShot", "Block Frames", _snapShotBlockFrames);
+	if (_snapShotBlockFrames < 1) {
+		_snapShotBlockFrames = 1;
+	}
+	ReadIniFile.ReadIni("SnapShot", "Time Stride", _snapShotTimeStride);
+	if (_snapShotTimeStride < 1) {
+		_snapShotTimeStride = 1;
+	}
+	ReadIniFile.ReadIni("SnapShot", "Start Time", _snapShotStartTime);
+	ReadIniFile.ReadIni("SnapShot", "End Time", _snapShotEndTime);
+	ReadIniFile.ReadIni("SnapShot", "Window Start X", _snapShotWindowStartX);
+	ReadIniFile.ReadIni("SnapShot", "Window End X", _snapShotWindowEndX);
+	ReadIniFile.ReadIni("SnapShot", "Cars", sMode, ReadIniFilePackage::TransformModeType::Lower);
+	_snapShotCars = SnapShotFile::ParseCarNumbers(sMode);
+	int enable;
+	ReadIniFile.ReadIni("SnapShot", "Archive", enable);
+	_snapShotArchive = (enable != 0);
+	ReadIniFile.ReadIni("CSV", "Significant Digits", _csvSignificantDigits);
+	if (_csvSignificantDigits < DoubleFormat::Shortest || _csvSignificantDigits > DoubleFormat::MaxDigits) {
+		throw std::invalid_argument("Invalid CSV Significant Digits:" + std::to_string(_csvSignificantDigits));
+	}
+	ReadIniFile.ReadIni("Field", "Enable", enable);
+	_fieldEnabled = (enable != 0);
+	ReadIniFile.ReadIni("Field", "Folder", _fieldFolderPath);
+	ReadIniFile.ReadIni("Field", "Format", sMode, ReadIniFilePackage::TransformModeType::Lower);
+	if (sMode == "csv") {
+		_fieldFormat = FieldFormatType::CSV;
+	}
+	else {
+		_fieldFormat = FieldFormatType::Binary;
+	}
+	ReadIniFile.ReadIni("Field", "Cell Length", _fieldCellLength);
+	if (!(_fieldCellLength > 0)) {
+		throw std::invalid_argument("Invalid Field Cell Length:" + std::to_string(_fieldCellLength));
+	}
+	ReadIniFile.ReadIni("Field", "Cell Time", _fieldCellTime);
+	if (!(_fieldCellTime > 0)) {
+		throw std::invalid_argument("Invalid Field Cell Time:" + std::to_string(_fieldCellTime));
+	}
+	std::string sLengths;
+	std::string sIntervals;
+	ReadIniFile.ReadIni("Detectors", "Positions", sMode, ReadIniFilePackage::TransformModeType::Lower);
+	ReadIniFile.ReadIni("Detectors", "Lengths", sLengths);
+	ReadIniFile.ReadIni("Detectors", "Intervals", sIntervals);
+	_detectors = DetectorArrayPackage::ParseDetectors(sMode, sLengths, sIntervals);
+	ReadIniFile.ReadIni("Jam", "Enable", enable);
+	_jamEnabled = (enable != 0);
+	ReadIniFile.ReadIni("Jam", "Folder", _jamFolderPath);
+	ReadIniFile.ReadIni("Jam", "Interval", _jamInterval);
+	if (_jamInterval < 1) {
+		_jamInterval = 1;
+	}
+	_jamSpeedThreshold = Calculate_Km_h_To_m_s(ReadIniFile.ReadIni("Jam", "Speed Threshold"));
+	ReadIniFile.ReadIni("Jam", "Gap Threshold", _jamGapThreshold);
+	ReadIniFile.ReadIni("Jam", "Min Cars", _jamMinCars);
+	if (_jamMinCars < 1) {
+		_jamMinCars = 1;
+	}
+	ReadIniFile.ReadIni("Time Series", "Enable", enable);
+	_timeSeriesEnabled = (enable != 0);
+	ReadIniFile.ReadIni("Time Series", "Folder", _timeSeriesFolderPath);
+	ReadIniFile.ReadIni("Time Series", "Format", sMode, ReadIniFilePackage::TransformModeType::Lower);
+	if (sMode == "csv") {
+		_timeSeriesFormat = TimeSeriesFormatType::CSV;
+	}
+	else {
+		_timeSeriesFormat = TimeSeriesFormatType::Binary;
+	}
+	ReadIniFile.ReadIni("Time Series", "Interval", _timeSeriesInterval);
+	if (_timeSeriesInterval < 1) {
+		_timeSeriesInterval = 1;
+	}
 }
 
 void StatisticsParametersClass::InitializeProperties(StatisticsParametersClass* const thisPtr) {
@@ -23,6 +130,37 @@ void StatisticsParametersClass::InitializeProperties(StatisticsParametersClass*
 	MeasurementStartX(std::bind(&StatisticsParametersClass::Get_MeasurementStartX, thisPtr));
 	MeasurementLength(std::bind(&StatisticsParametersClass::Get_MeasurementLength, thisPtr));
 	MeasurementEndX(std::bind(&StatisticsParametersClass::Get_MeasurementEndX, thisPtr));
+	SnapShotFormat(std::bind(&StatisticsParametersClass::Get_SnapShotFormat, thisPtr));
+	SnapShotPrecision(std::bind(&StatisticsParametersClass::Get_SnapShotPrecision, thisPtr));
+	SnapShotChannels(std::bind(&StatisticsParametersClass::Get_SnapShotChannels, thisPtr));
+	SnapShotBufferFrames(std::bind(&StatisticsParametersClass::Get_SnapShotBufferFrames, thisPtr));
+	SnapShotKeyframeInterval(std::bind(&StatisticsParametersClass::Get_SnapShotKeyframeInterval, thisPtr));
+	SnapShotResolution(std::bind(&StatisticsParametersClass::Get_SnapShotResolution, thisPtr));
+	SnapShotBlockFrames(std::bind(&StatisticsParametersClass::Get_SnapShotBlockFrames, thisPtr));
+	SnapShotTimeStride(std::bind(&StatisticsParametersClass::Get_SnapShotTimeStride, thisPtr));
+	SnapShotStartTime(std::bind(&StatisticsParametersClass::Get_SnapShotStartTime, thisPtr));
+	SnapShotEndTime(std::bind(&StatisticsParametersClass::Get_SnapShotEndTime, thisPtr));
+	SnapShotWindowStartX(std::bind(&StatisticsParametersClass::Get_SnapShotWindowStartX, thisPtr));
+	SnapShotWindowEndX(std::bind(&StatisticsParametersClass::Get_SnapShotWindowEndX, thisPtr));
+	SnapShotCars(std::bind(&StatisticsParametersClass::Get_SnapShotCars, thisPtr));
+	SnapShotArchive(std::bind(&StatisticsParametersClass::Get_SnapShotArchive, thisPtr));
+	CSVSignificantDigits(std::bind(&StatisticsParametersClass::Get_CSVSignificantDigits, thisPtr));
+	FieldEnabled(std::bind(&StatisticsParametersClass::Get_FieldEnabled, thisPtr));
+	FieldFolderPath(std::bind(&StatisticsParametersClass::Get_FieldFolderPath, thisPtr));
+	FieldFormat(std::bind(&StatisticsParametersClass::Get_FieldFormat, thisPtr));
+	FieldCellLength(std::bind(&StatisticsParametersClass::Get_FieldCellLength, thisPtr));
+	FieldCellTime(std::bind(&StatisticsParametersClass::Get_FieldCellTime, thisPtr));
+	Detectors(std::bind(&StatisticsParametersClass::Get_Detectors, thisPtr));
+	JamEnabled(std::bind(&StatisticsParametersClass::Get_JamEnabled, thisPtr));
+	JamFolderPath(std::bind(&StatisticsParametersClass::Get_JamFolderPath, thisPtr));
+	JamInterval(std::bind(&StatisticsParametersClass::Get_JamInterval, thisPtr));
+	JamSpeedThreshold(std::bind(&StatisticsParametersClass::Get_JamSpeedThreshold, thisPtr));
+	JamGapThreshold(std::bind(&StatisticsParametersClass::Get_JamGapThreshold, thisPtr));
+	JamMinCars(std::bind(&StatisticsParametersClass::Get_JamMinCars, thisPtr));
+	TimeSeriesEnabled(std::bind(&StatisticsParametersClass::Get_TimeSeriesEnabled, thisPtr));
+	TimeSeriesFolderPath(std::bind(&StatisticsParametersClass::Get_TimeSeriesFolderPath, thisPtr));
+	TimeSeriesFormat(std::bind(&StatisticsParametersClass::Get_TimeSeriesFormat, thisPtr));
+	TimeSeriesInterval(std::bind(&StatisticsParametersClass::Get_TimeSeriesInterval, thisPtr));
 }
 
 const int& StatisticsParametersClass::Get_UnitMeasurementTime() const {
@@ -44,3 +182,127 @@ const double& StatisticsParametersClass::Get_MeasurementStartX() const {
 const double& StatisticsParametersClass::Get_MeasurementEndX() const {
 	return _measurementEndX;
 }
+
+const SnapShotFormatType& StatisticsParametersClass::Get_SnapShotFormat() const {
+	return _snapShotFormat;
+}
+
+const SnapShotPrecisionType& StatisticsParametersClass::Get_SnapShotPrecision() const {
+	return _snapShotPrecision;
+}
+
+const std::uint32_t& StatisticsParametersClass::Get_SnapShotChannels() const {
+	return _snapShotChannels;
+}
+
+const int& StatisticsParametersClass::Get_SnapShotBufferFrames() const {
+	return _snapShotBufferFrames;
+}
+
+const int& StatisticsParametersClass::Get_SnapShotKeyframeInterval() const {
+	return _snapShotKeyframeInterval;
+}
+
+const double& StatisticsParametersClass::Get_SnapShotResolution() const {
+	return _snapShotResolution;
+}
+
+const int& StatisticsParametersClass::Get_SnapShotBlockFrames() const {
+	return _snapShotBlockFrames;
+}
+
+const int& StatisticsParametersClass::Get_SnapShotTimeStride() const {
+	return _snapShotTimeStride;
+}
+
+const double& StatisticsParametersClass::Get_SnapShotStartTime() const {
+	return _snapShotStartTime;
+}
+
+const double& StatisticsParametersClass::Get_SnapShotEndTime() const {
+	return _snapShotEndTime;
+}
+
+const double& StatisticsParametersClass::Get_SnapShotWindowStartX() const {
+	return _snapShotWindowStartX;
+}
+
+const double& StatisticsParametersClass::Get_SnapShotWindowEndX() const {
+	return _snapShotWindowEndX;
+}
+
+const std::vector<std::uint32_t>& StatisticsParametersClass::Get_SnapShotCars() const {
+	return _snapShotCars;
+}
+
+const bool& StatisticsParametersClass::Get_SnapShotArchive() const {
+	return _snapShotArchive;
+}
+
+const int& StatisticsParametersClass::Get_CSVSignificantDigits() const {
+	return _csvSignificantDigits;
+}
+
+const bool& StatisticsParametersClass::Get_FieldEnabled() const {
+	return _fieldEnabled;
+}
+
+const std::string& StatisticsParametersClass::Get_FieldFolderPath() const {
+	return _fieldFolderPath;
+}
+
+const FieldFormatType& StatisticsParametersClass::Get_FieldFormat() const {
+	return _fieldFormat;
+}
+
+const double& StatisticsParametersClass::Get_FieldCellLength() const {
+	return _fieldCellLength;
+}
+
+const double& StatisticsParametersClass::Get_FieldCellTime() const {
+	return _fieldCellTime;
+}
+
+const std::vector<DetectorArrayPackage::Detector>& StatisticsParametersClass::Get_Detectors() const {
+	return _detectors;
+}
+
+const bool& StatisticsParametersClass::Get_JamEnabled() const {
+	return _jamEnabled;
+}
+
+const std::string& StatisticsParametersClass::Get_JamFolderPath() const {
+	return _jamFolderPath;
+}
+
+const int& StatisticsParametersClass::Get_JamInterval() const {
+	return _jamInterval;
+}
+
+const double& StatisticsParametersClass::Get_JamSpeedThreshold() const {
+	return _jamSpeedThreshold;
+}
+
+const double& StatisticsParametersClass::Get_JamGapThreshold() const {
+	return _jamGapThreshold;
+}
+
+const int& StatisticsParametersClass::Get_JamMinCars() const {
+	return _jamMinCars;
+}
+
+const bool& StatisticsParametersClass::Get_TimeSeriesEnabled() const {
+	return _timeSeriesEnabled;
+}
+
+const std::string& StatisticsParametersClass::Get_TimeSeriesFolderPath() const {
+	return _timeSeriesFolderPath;
+}
+
+const TimeSeriesFormatType& StatisticsParametersClass::Get_TimeSeriesFormat() const {
+	return _timeSeriesFormat;
+}
+
+const int& StatisticsParametersClass::Get_TimeSeriesInterval() const {
+	return _timeSeriesInterval;
+}
@@ -4,8 +4,16 @@
 
 #ifndef STATISTICSPARAMETERSCLASS_H
 #define STATISTICSPARAMETERSCLASS_H
+#include <cstdint>
+#include <vector>
 #include "ReadIniFilePackage.h"
 #include "ReadOnlyPropertyClass.h"
+#include "Common.h"
+#include "DoubleFormatPackage.h"
+#include "SnapShotFilePackage.h"
+#include "SpaceTimeFieldPackage.h"
+#include "DetectorArrayPackage.h"
+#include "TimeSeriesPackage.h"
 
 class StatisticsParametersClass {
 public:
@@ -16,6 +24,37 @@ private:
 	double _measurementLength;
 	double _measurementStartX;
 	double _measurementEndX;
+	SnapShotFormatType _snapShotFormat;
+	SnapShotPrecisionType _snapShotPrecision;
+	std::uint32_t _snapShotChannels;
+	int _snapShotBufferFrames;
+	int _snapShotKeyframeInterval;
+	double _snapShotResolution;
+	int _snapShotBlockFrames;
+	int _snapShotTimeStride;
+	double _snapShotStartTime;
+	double _snapShotEndTime;
+	double _snapShotWindowStartX;
+	double _snapShotWindowEndX;
+	std::vector<std::uint32_t> _snapShotCars;
+	bool _snapShotArchive;
+	int _csvSignificantDigits;
+	bool _fieldEnabled;
+	std::string _fieldFolderPath;
+	FieldFormatType _fieldFormat;
+	double _fieldCellLength;
+	double _fieldCellTime;
+	std::vector<DetectorArrayPackage::Detector> _detectors;
+	bool _jamEnabled;
+	std::string _jamFolderPath;
+	int _jamInterval;
+	double _jamSpeedThreshold;
+	double _jamGapThreshold;
+	int _jamMinCars;
+	bool _timeSeriesEnabled;
+	std::string _timeSeriesFolderPath;
+	TimeSeriesFormatType _timeSeriesFormat;
+	int _timeSeriesInterval;
 
 	void InitializeProperties(StatisticsParametersClass* const thisPtr);
 
@@ -24,12 +63,74 @@ private:
 	const double& Get_MeasurementLength() const;
 	const double& Get_MeasurementStartX() const;
 	const double& Get_MeasurementEndX() const;
+	const SnapShotFormatType& Get_SnapShotFormat() const;
+	const SnapShotPrecisionType& Get_SnapShotPrecision() const;
+	const std::uint32_t& Get_SnapShotChannels() const;
+	const int& Get_SnapShotBufferFrames() const;
+	const int& Get_SnapShotKeyframeInterval() const;
+	const double& Get_SnapShotResolution() const;
+	const int& Get_SnapShotBlockFrames() const;
+	const int& Get_SnapShotTimeStride() const;
+	const double& Get_SnapShotStartTime() const;
+	const double& Get_SnapShotEndTime() const;
+	const double& Get_SnapShotWindowStartX() const;
+	const double& Get_SnapShotWindowEndX() const;
+	const std::vector<std::uint32_t>& Get_SnapShotCars() const;
+	const bool& Get_SnapShotArchive() const;
+	const int& Get_CSVSignificantDigits() const;
+	const bool& Get_FieldEnabled() const;
+	const std::string& Get_FieldFolderPath() const;
+	const FieldFormatType& Get_FieldFormat() const;
+	const double& Get_FieldCellLength() const;
+	const double& Get_FieldCellTime() const;
+	const std::vector<DetectorArrayPackage::Detector>& Get_Detectors() const;
+	const bool& Get_JamEnabled() const;
+	const std::string& Get_JamFolderPath() const;
+	const int& Get_JamInterval() const;
+	const double& Get_JamSpeedThreshold() const;
+	const double& Get_JamGapThreshold() const;
+	const int& Get_JamMinCars() const;
+	const bool& Get_TimeSeriesEnabled() const;
+	const std::string& Get_TimeSeriesFolderPath() const;
+	const TimeSeriesFormatType& Get_TimeSeriesFormat() const;
+	const int& Get_TimeSeriesInterval() const;
 public:
 	ReadOnlyPropertyClass<const int&> UnitMeasurementTime;
 	ReadOnlyPropertyClass<const int&> NumberOfMeasurements;
 	ReadOnlyPropertyClass<const double&> MeasurementLength;
 	ReadOnlyPropertyClass<const double&> MeasurementStartX;
 	ReadOnlyPropertyClass<const double&> MeasurementEndX;
+	ReadOnlyPropertyClass<const SnapShotFormatType&> SnapShotFormat;
+	ReadOnlyPropertyClass<const SnapShotPrecisionType&> SnapShotPrecision;	//Binary and vehicle-major formats only
+	ReadOnlyPropertyClass<const std::uint32_t&> SnapShotChannels;	//Combination of "SnapShotFile::Channel". Binary format only, the CSV has only x.
+	ReadOnlyPropertyClass<const int&> SnapShotBufferFrames;	//0 means that the snapshot is written in the step loop without the writer thread.
+	ReadOnlyPropertyClass<const int&> SnapShotKeyframeInterval;	//Time steps between the keyframes of the event log.
+	ReadOnlyPropertyClass<const double&> SnapShotResolution;	//Quantization step of the compressed snapshot.
+	ReadOnlyPropertyClass<const int&> SnapShotBlockFrames;	//Frames in a block of the compressed snapshot, or in a tile of the vehicle-major snapshot.
+	ReadOnlyPropertyClass<const int&> SnapShotTimeStride;	//Every n-th time step is recorded. Always 1 for the event log.
+	ReadOnlyPropertyClass<const double&> SnapShotStartTime;	//s from the start of a measurement
+	ReadOnlyPropertyClass<const double&> SnapShotEndTime;	//s from the start of a measurement. 0 means the end of the measurement.
+	ReadOnlyPropertyClass<const double&> SnapShotWindowStartX;
+	ReadOnlyPropertyClass<const double&> SnapShotWindowEndX;	//The cars in [SnapShotWindowStartX, SnapShotWindowEndX) are recorded. The whole ring if they are the same.
+	ReadOnlyPropertyClass<const std::vector<std::uint32_t>&> SnapShotCars;	//The car numbers (1-based ID) to record. Empty means all cars.
+	ReadOnlyPropertyClass<const bool&> SnapShotArchive;	//The snapshots of an ini file and a run are appended to a single archive file.
+	ReadOnlyPropertyClass<const int&> CSVSignificantDigits;	//Significant digits of the numbers in the result and snapshot CSV files. "DoubleFormat::Shortest" means the shortest digits read back to the same value.
+	ReadOnlyPropertyClass<const bool&> FieldEnabled;	//The space-time grid of each measurement is written.
+	ReadOnlyPropertyClass<const std::string&> FieldFolderPath;
+	ReadOnlyPropertyClass<const FieldFormatType&> FieldFormat;
+	ReadOnlyPropertyClass<const double&> FieldCellLength;	//m
+	ReadOnlyPropertyClass<const double&> FieldCellTime;	//s
+	ReadOnlyPropertyClass<const std::vector<DetectorArrayPackage::Detector>&> Detectors;	//The detectors other than that of "Statistics Parameters", in the order of the ".ini" file. Empty means none.
+	ReadOnlyPropertyClass<const bool&> JamEnabled;	//The congested clusters are tracked, and their events of each measurement are written.
+	ReadOnlyPropertyClass<const std::string&> JamFolderPath;
+	ReadOnlyPropertyClass<const int&> JamInterval;	//Time steps between the scans of the clusters
+	ReadOnlyPropertyClass<const double&> JamSpeedThreshold;	//m/s
+	ReadOnlyPropertyClass<const double&> JamGapThreshold;	//m
+	ReadOnlyPropertyClass<const int&> JamMinCars;	//The fewest cars of a cluster
+	ReadOnlyPropertyClass<const bool&> TimeSeriesEnabled;	//The global state of the ring is sampled during each measurement.
+	ReadOnlyPropertyClass<const std::string&> TimeSeriesFolderPath;
+	ReadOnlyPropertyClass<const TimeSeriesFormatType&> TimeSeriesFormat;
+	ReadOnlyPropertyClass<const int&> TimeSeriesInterval;	//Time steps between the samples
 };
 
 #endif // !STATISTICSPARAMETERSCLASS_H
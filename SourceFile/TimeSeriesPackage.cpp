@@ -0,0 +1,104 @@
+/*
+	This is cpp file of the class of "TimeSeriesPackage" that records the global state of the ring every "Interval" time steps during each measurement.
+*/
+
+#include "TimeSeriesPackage.h"
+
+//constructor
+TimeSeriesPackage::Series::Series(const TimeSeriesPackage& TimeSeries, const int& N, const int& UnitMeasurementTime) : timeSeries(TimeSeries), N(N) {
+	steps = 0;
+	samples.reserve(std::size_t(UnitMeasurementTime / timeSeries.deltaT / timeSeries.interval) + 2);
+}
+
+/*
+	Start a new measurement.
+*/
+void TimeSeriesPackage::Series::Clear() {
+	steps = 0;
+	samples.clear();
+}
+
+/*
+	Advance to the next time step, and take a sample at the interval. "global_dX" is the distance travelled by all cars in the time step.
+	The cars are read only when a sample is taken.
+*/
+void TimeSeriesPackage::Series::EndStep(const std::vector<CarStruct*>& cars, const double& global_dX) {
+	steps++;
+	if (steps % timeSeries.interval != 0) {
+		return;
+	}
+	Sample sample;
+	sample.Time = double(steps) * timeSeries.deltaT;
+	const double&& v = global_dX / N / timeSeries.deltaT;
+	sample.V = Calculate_m_s_To_Km_h(v);
+	sample.Flow = N / timeSeries.L * v * 3600;
+	double sum = 0;
+	double sum2 = 0;
+	sample.Stopped = 0;
+	sample.RecognitionHits = 0;
+	sample.Emergencies = 0;
+	for (const CarStruct* const car : cars) {
+		const double& carV = car->Moment->v;
+		sum += carV;
+		sum2 += carV * carV;
+		if (carV == 0) {
+			sample.Stopped++;
+		}
+		const DriverElements::MomentValues* const driverMoment = car->Driver->Moment;
+		if (driverMoment->recognitionHit) {
+			sample.RecognitionHits++;
+		}
+		if (driverMoment->g->emergency) {
+			sample.Emergencies++;
+		}
+	}
+	const double&& mean = sum / N;
+	sample.Variance = std::pow(Calculate_m_s_To_Km_h(1), 2) * (std::max)(sum2 / N - mean * mean, 0.0);
+	samples.emplace_back(sample);
+}
+
+//constructor
+TimeSeriesPackage::TimeSeriesPackage(const std::string& FolderPath, const int& IniFileNumber, const int& RunNumber, const TimeSeriesFormatType& Format, const int& Interval, const double& L, const double& deltaT, const int& Digits)
+	: format(Format), interval(Interval), L(L), deltaT(deltaT), digits(Digits), Files(FolderPath, IniFileNumber, RunNumber, "TimeSeries") { }
+
+//destructor
+TimeSeriesPackage::~TimeSeriesPackage() { }
+
+/*
+	Write the samples of the measurement. Return false if the file cannot be written.
+*/
+bool TimeSeriesPackage::Write(const Series& series, const int& N, const int& MeasureNumber) const {
+	switch (format) {
+	case TimeSeriesFormatType::CSV:
+		return Files.Write(Files.Path(N, MeasureNumber, ".csv"), false, [&](std::ostream& os) { WriteCSV(series, os); });
+	default:
+		return Files.Write(Files.Path(N, MeasureNumber, ".ts"), true, [&](std::ostream& os) { WriteBinary(series, N, MeasureNumber, os); });
+	}
+}
+
+void TimeSeriesPackage::WriteBinary(const Series& series, const int& N, const int& MeasureNumber, std::ostream& ofs) const {
+	ofs.write("CTFMTS01", 8);
+	BinaryIO::Write(ofs, std::uint32_t(N));
+	BinaryIO::Write(ofs, std::uint32_t(MeasureNumber));
+	BinaryIO::Write(ofs, std::uint32_t(interval));
+	BinaryIO::Write(ofs, std::uint32_t(series.samples.size()));
+	BinaryIO::Write(ofs, L);
+	BinaryIO::Write(ofs, deltaT);
+	for (const Series::Sample& sample : series.samples) {
+		BinaryIO::Write(ofs, sample.Time);
+		BinaryIO::Write(ofs, sample.Flow);
+		BinaryIO::Write(ofs, sample.V);
+		BinaryIO::Write(ofs, sample.Variance);
+		BinaryIO::Write(ofs, sample.Stopped);
+		BinaryIO::Write(ofs, sample.RecognitionHits);
+		BinaryIO::Write(ofs, sample.Emergencies);
+	}
+}
+
+void TimeSeriesPackage::WriteCSV(const Series& series, std::ostream& ofs) const {
+	ofs << "Time,Flow,V,Variance,Stopped,RecognitionHits,Emergencies" << "\n";
+	for (const Series::Sample& sample : series.samples) {
+		ofs << DoubleFormat::Text(sample.Time, digits) << "," << DoubleFormat::Text(sample.Flow, digits) << "," << DoubleFormat::Text(sample.V, digits) << "," << DoubleFormat::Text(sample.Variance, digits)
+			<< "," << sample.Stopped << "," << sample.RecognitionHits << "," << sample.Emergencies << "\n";
+	}
+}
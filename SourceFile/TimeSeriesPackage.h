@@ -0,0 +1,74 @@
+/*
+	This is header file of the class of "TimeSeriesPackage" that records the global state of the ring every "Interval" time steps during each measurement.
+	A sample is the time, the flow (veh/h) and the mean speed (km/h) given by the distance travelled by all cars in the time step,
+	the variance of the velocities of the cars ((km/h)^2), and the numbers of the stopped cars, the drivers with a recognition hit and the drivers in an emergency.
+	Each simulation records the samples into its own "Series", and the samples of each measurement are written as "TimeSeries_N<N>_MeasureN<measure>" (with "_RunN<run>").
+	The binary file (".ts") is "CTFMTS01", N, the measure number, "Interval", the number of the samples (uint32), L and deltaT (float64),
+	followed by the samples: the time, the flow, the mean speed and the variance (float64), the stopped cars, the recognition hits and the emergencies (uint32).
+	The CSV file (".csv") has the same values with a header.
+*/
+
+#ifndef TIMESERIESPACKAGE_H
+#define TIMESERIESPACKAGE_H
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+#include "BinaryIOPackage.h"
+#include "CarStruct.h"
+#include "Common.h"
+#include "DoubleFormatPackage.h"
+#include "MeasurementFilePackage.h"
+
+enum class TimeSeriesFormatType {
+	Binary
+	, CSV
+};
+
+class TimeSeriesPackage {
+public:
+	//The samples of a measurement of a simulation
+	class Series {
+	public:
+		Series(const TimeSeriesPackage& TimeSeries, const int& N, const int& UnitMeasurementTime);	//constructor. The samples of a measurement are reserved here.
+
+		void Clear();	//Start a new measurement.
+		void EndStep(const std::vector<CarStruct*>& cars, const double& global_dX);	//Advance to the next time step, and take a sample at the interval. "global_dX" is the distance travelled by all cars in the time step.
+	private:
+		struct Sample {
+			double Time;	//s
+			double Flow;	//veh/h
+			double V;	//km/h
+			double Variance;	//(km/h)^2
+			std::uint32_t Stopped;
+			std::uint32_t RecognitionHits;
+			std::uint32_t Emergencies;
+		};
+
+		const TimeSeriesPackage& timeSeries;
+		const int N;
+		long long steps;	//Time steps of the current measurement
+		std::vector<Sample> samples;
+
+		friend class TimeSeriesPackage;
+	};
+
+	TimeSeriesPackage(const std::string& FolderPath, const int& IniFileNumber, const int& RunNumber, const TimeSeriesFormatType& Format, const int& Interval, const double& L, const double& deltaT, const int& Digits);	//constructor
+	~TimeSeriesPackage();	//destructor
+
+	bool Write(const Series& series, const int& N, const int& MeasureNumber) const;	//Write the samples of the measurement. Return false if the file cannot be written.
+private:
+	const TimeSeriesFormatType format;
+	const int interval;	//Time steps
+	const double L;
+	const double deltaT;
+	const int digits;
+	const MeasurementFilePackage Files;
+
+	void WriteBinary(const Series& series, const int& N, const int& MeasureNumber, std::ostream& ofs) const;
+	void WriteCSV(const Series& series, std::ostream& ofs) const;
+};
+
+#endif // !TIMESERIESPACKAGE_H
@@ -6,8 +6,8 @@
 #include "UpdatePositionClass.h"
 
 //constructor
-UpdatePositionClass::UpdatePositionClass(StatisticsClass* const statistics, const PedalChangePackage* const PedalChange, const ModelBaseClass* const baseClass)
-	: statistics(statistics), PedalChange(PedalChange), ModelBaseClass(baseClass) {
+UpdatePositionClass::UpdatePositionClass(StatisticsClass* const statistics, DetectorArrayPackage::Counters* const detectorCounters, const PedalChangePackage* const PedalChange, const ModelBaseClass* const baseClass)
+	: statistics(statistics), detectorCounters(detectorCounters), PedalChange(PedalChange), ModelBaseClass(baseClass) {
 	InitializeProperties(this);
 }
 
@@ -33,19 +33,9 @@ void UpdatePositionClass::UpdateCarPosition(const CarStruct* const car) {
 	const double& a = carMoment->a;
 
 	double nextX;
-	double nextV = v + a * ModelParameters.deltaT;
-	if (nextV > 0) {
-		nextX = x + v * ModelParameters.deltaT + 0.5 * a * std::pow(ModelParameters.deltaT, 2);
-	}
-	else {
-		//Due to the model, go backwards is not allowed.
-		if (a < 0) {
-			nextX = x - 0.5 * std::pow(v, 2) / a;
-		}
-		else {
-			nextX = x;
-		}
-		nextV = 0;
+	double nextV;
+	_a = a;
+	if (Kinematics::Advance(x, v, a, ModelParameters.deltaT, ModelParameters.L, nextX, nextV)) {
 		carMoment->a = 0;
 		DriverElements::MomentValues* driverMoment = driver->Moment;
 		if (driverMoment->a < 0) {
@@ -57,9 +47,6 @@ void UpdatePositionClass::UpdateCarPosition(const CarStruct* const car) {
 			pedal->footPosition = FootPositionType::Brake;
 		}
 	}
-	if (nextX >= ModelParameters.L) {
-		nextX -= ModelParameters.L;
-	}
 	//Get statistics.
 	//This model uses the same measurement distance as loop coil vehicle detectors on Japanese expressways.
 	CarElements::MomentValuesElements::Measurement* const measurement = carMoment->measurement;
@@ -94,6 +81,9 @@ void UpdatePositionClass::UpdateCarPosition(const CarStruct* const car) {
 	else {
 		_dX = nextX + ModelParameters.L - x;
 	}
+	if (detectorCounters != nullptr) {
+		detectorCounters->Update(car->ID, x, _dX, v, a);
+	}
 	carMoment->x = std::move(nextX);
 	carMoment->v = std::move(nextV);
 	_position = carMoment->x;
@@ -132,19 +122,13 @@ void UpdatePositionClass::DecideNextCarAcceleration(const CarStruct* const car)
 }
 
 double UpdatePositionClass::GetElapsedTime(const CarStruct* const car, const double& x0, const double& x1) const {
-	const double& a = car->Moment->a;
-	const double& v = car->Moment->v;
-	if (a == 0) {
-		return (x1 - x0) / v;
-	}
-	else {
-		return (-v + std::sqrt(std::pow(v, 2) + 2 * a * (x1 - x0))) / a;
-	}
+	return Kinematics::ElapsedTime(car->Moment->v, car->Moment->a, x1 - x0);
 }
 
 void UpdatePositionClass::InitializeProperties(UpdatePositionClass* const thisPtr) {
 	dX(std::bind(&UpdatePositionClass::Get_dX, thisPtr));
 	Position(std::bind(&UpdatePositionClass::Get_Position, thisPtr));
+	A(std::bind(&UpdatePositionClass::Get_A, thisPtr));
 }
 
 const double& UpdatePositionClass::Get_dX() const {
@@ -154,3 +138,7 @@ const double& UpdatePositionClass::Get_dX() const {
 const double& UpdatePositionClass::Get_Position() const {
 	return _position;
 }
+
+const double& UpdatePositionClass::Get_A() const {
+	return _a;
+}
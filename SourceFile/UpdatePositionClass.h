@@ -10,18 +10,22 @@
 #include "ReadOnlyPropertyClass.h"
 #include "PedalChangePackage.h"
 #include "ModelBaseClass.h"
+#include "KinematicsPackage.h"
+#include "DetectorArrayPackage.h"
 
 class UpdatePositionClass : public ModelBaseClass {
 public:
-	UpdatePositionClass(StatisticsClass* const statistics, const PedalChangePackage* const PedalChange, const ModelBaseClass* const baseClass);	//constructor
+	UpdatePositionClass(StatisticsClass* const statistics, DetectorArrayPackage::Counters* const detectorCounters, const PedalChangePackage* const PedalChange, const ModelBaseClass* const baseClass);	//constructor. "detectorCounters" can be nullptr.
 	~UpdatePositionClass();	//destructor
 	
 	void UpdateCarPosition(const CarStruct* const car);	//Move the car position by one time step.
 private:
 	StatisticsClass* const statistics;
+	DetectorArrayPackage::Counters* const detectorCounters;	//nullptr if there is no detector other than that of "Statistics Parameters".
 	const PedalChangePackage* const PedalChange;
 	double _dX;
 	double _position;
+	double _a;
 
 	void DecideNextCarAcceleration(const CarStruct* const car) const;	//Determine the car's actual acceleration for the next timestep.
 	double GetElapsedTime(const CarStruct* const car, const double& x0, const double& x1) const;
@@ -30,9 +34,11 @@ private:
 
 	const double& Get_dX() const;
 	const double& Get_Position() const;
+	const double& Get_A() const;
 public:
 	ReadOnlyPropertyClass<const double&> dX;
 	ReadOnlyPropertyClass<const double&> Position;
+	ReadOnlyPropertyClass<const double&> A;	//The acceleration used to move the car in the last time step.
 };
 
 #endif // !UPDATEPOSITIONCLASS_H
@@ -1,11 +1,15 @@
 #include "random.h"
 
 Random::Random() {
-	Initialize_mt19937(0);
+	Initialize_mt19937(CreateSeed(0, 0));
 }
 
 Random::Random(const int& seedAuxiliaryValue) {
-	Initialize_mt19937(seedAuxiliaryValue);
+	Initialize_mt19937(CreateSeed(seedAuxiliaryValue, 0));
+}
+
+Random::Random(const unsigned int& seed) {
+	Initialize_mt19937(seed);
 }
 
 Random::~Random() {
@@ -31,8 +35,56 @@ double Random::operator()(const double& Dmin, const double& Dmax) const {
 	return create_double_rand(Dmin, Dmax);
 }
 
-void Random::Initialize_mt19937(const int& seedAuxiliaryValue) {
-	mt = new std::mt19937((unsigned int)(seedAuxiliaryValue * 1000 + time(nullptr)));
+const unsigned int& Random::Seed() const {
+	return seed;
+}
+
+/*
+	Get the internal state of the generator so that the sequence can be continued later.
+*/
+std::string Random::SaveState() const {
+	std::stringstream SS;
+	SS << *mt;
+	return SS.str();
+}
+
+/*
+	Restore the internal state got by "SaveState".
+*/
+bool Random::LoadState(const std::string& state) const {
+	std::stringstream SS(state);
+	std::mt19937 loaded;
+	SS >> loaded;
+	if (SS.fail()) {
+		return false;
+	}
+	*mt = loaded;
+	return true;
+}
+
+/*
+	Restart the sequence from a new seed.
+*/
+void Random::Reseed(const unsigned int& seed) const {
+	this->seed = seed;
+	mt->seed(seed);
+}
+
+/*
+	Create the seed. If "fixedSeed" is 0, the current time is used instead of it.
+*/
+unsigned int Random::CreateSeed(const int& seedAuxiliaryValue, const int& fixedSeed) {
+	if (fixedSeed == 0) {
+		return (unsigned int)(seedAuxiliaryValue * 1000 + time(nullptr));
+	}
+	else {
+		return (unsigned int)(seedAuxiliaryValue * 1000 + fixedSeed);
+	}
+}
+
+void Random::Initialize_mt19937(const unsigned int& seed) {
+	this->seed = seed;
+	mt = new std::mt19937(seed);
 }
 
 int Random::create_int_rand(const int& xmin, const int& xmax) const {
@@ -43,4 +95,4 @@ int Random::create_int_rand(const int& xmin, const int& xmax) const {
 double Random::create_double_rand(const double& xmin, const double& xmax) const {
 	std::uniform_real_distribution<> rd(xmin, xmax);
 	return rd(*mt);
-}
\ No newline at end of file
+}
@@ -4,24 +4,36 @@
 #include <array>
 #include <ctime>
 #include <functional>
+#include <iostream>
 #include <random>
+#include <sstream>
+#include <string>
 
 class Random {
 public:
 	Random();
 	Random(const int& seedAuxiliaryValue);
+	Random(const unsigned int& seed);
 	~Random();
 
 	int operator()(const int& N) const;
 	int operator()(const int& Nmin, const int& Nmax) const;
 	double operator()(const double& D) const;
 	double operator()(const double& Dmin, const double& Dmax) const;
+
+	const unsigned int& Seed() const;
+	std::string SaveState() const;	//Get the internal state of the generator so that the sequence can be continued later.
+	bool LoadState(const std::string& state) const;	//Restore the internal state got by "SaveState".
+	void Reseed(const unsigned int& seed) const;	//Restart the sequence from a new seed.
+
+	static unsigned int CreateSeed(const int& seedAuxiliaryValue, const int& fixedSeed);	//Create the seed. If "fixedSeed" is 0, the current time is used instead of it.
 private:
 	std::mt19937* mt;
+	mutable unsigned int seed;
 
-	void Initialize_mt19937(const int& seedAuxiliaryValue);
+	void Initialize_mt19937(const unsigned int& seed);
 	int create_int_rand(const int& xmin, const int& xmax) const;
 	double create_double_rand(const double& xmin, const double& xmax) const;
 };
 
-#endif	//RANDOM_H
\ No newline at end of file
+#endif	//RANDOM_H
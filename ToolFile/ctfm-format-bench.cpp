@@ -0,0 +1,104 @@
+/*
+	This is the cpp file of the tool "ctfm-format-bench" that measures the speed of writing the numbers of the CSV files.
+	The values like the rows of a snapshot (time, then the positions on the road) are written to memory by each way below, and the speed is shown in MB/s of the text.
+		ostream <<                 : The previous way with the default 6 significant digits
+		ostream << setprecision(17): The digits that are read back to the same value with iostreams
+		DoubleFormat 6             : "DoubleFormat" with 6 significant digits
+		DoubleFormat shortest      : "DoubleFormat" with the shortest digits read back to the same value
+	The text of "DoubleFormat" is checked to be read back to the same value.
+	Usage:
+		ctfm-format-bench [number of values] [L]	: 1000000 values and L=10000 by default
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "DoubleFormatPackage.h"
+
+namespace {
+	const std::size_t RowSize = 100;	//Values in a row
+
+	//The speed is shown in MB/s of the text and in million values per second, since the text of 6 digits is shorter.
+	template<typename _F>
+	double Measure(const std::string& name, const std::size_t& count, const std::size_t& repeat, std::size_t& bytes, _F write) {
+		const std::chrono::steady_clock::time_point&& start = std::chrono::steady_clock::now();
+		for (std::size_t i = 0; i < repeat; i++) {
+			bytes = write();
+		}
+		const std::chrono::duration<double>&& elapsed = std::chrono::steady_clock::now() - start;
+		const double&& speed = double(bytes) * double(repeat) / elapsed.count() / 1e6;
+		std::cout << std::left << std::setw(28) << name << std::right << std::setw(10) << std::fixed << std::setprecision(1) << speed << "MB/s" << std::setw(10) << double(count) * double(repeat) / elapsed.count() / 1e6 << "M values/s  " << bytes << "bytes" << std::endl;
+		return speed;
+	}
+
+	std::size_t WriteStream(std::ostringstream& oss, const std::vector<double>& values) {
+		oss.str(std::string());
+		for (std::size_t i = 0; i < values.size(); i++) {
+			oss << values[i] << ((i + 1) % RowSize == 0 ? "\n" : ",");
+		}
+		return oss.str().size();
+	}
+
+	std::size_t WriteDoubleFormat(std::string& text, const std::vector<double>& values, const int& digits) {
+		text.clear();
+		for (std::size_t i = 0; i < values.size(); i++) {
+			DoubleFormat::Append(text, values[i], digits);
+			text += (i + 1) % RowSize == 0 ? '\n' : ',';
+		}
+		return text.size();
+	}
+}
+
+int main(int argc, char *argv[]) {
+	const std::size_t&& count = argc > 1 ? std::size_t(std::stoull(argv[1])) : 1000000;
+	const double&& L = argc > 2 ? std::stod(argv[2]) : 10000;
+	if (count == 0 || !(L > 0)) {
+		std::cerr << "Usage:" << std::endl;
+		std::cerr << "  ctfm-format-bench [number of values] [L]" << std::endl;
+		return 1;
+	}
+	//Time with the step of 0.1 s, then the positions of the cars and the velocities
+	std::mt19937_64 engine(1);
+	std::uniform_real_distribution<double> position(0, L);
+	std::uniform_real_distribution<double> velocity(0, 30);
+	std::vector<double> values(count);
+	for (std::size_t i = 0; i < count; i++) {
+		if (i % RowSize == 0) {
+			values[i] = double(i / RowSize) * 0.1;
+		}
+		else {
+			values[i] = (i % 2 == 0) ? position(engine) : velocity(engine);
+		}
+	}
+
+	std::string text;
+	std::size_t pos = 0;
+	WriteDoubleFormat(text, values, DoubleFormat::Shortest);
+	for (std::size_t i = 0; i < count; i++) {
+		const std::size_t&& end = text.find_first_of(",\n", pos);
+		if (std::strtod(text.c_str() + pos, nullptr) != values[i]) {
+			std::cerr << "Not Read Back:" << text.substr(pos, end - pos) << std::endl;
+			return 1;
+		}
+		pos = end + 1;
+	}
+
+	const std::size_t repeat = std::max(std::size_t(1), std::size_t(5000000) / count);
+	std::size_t bytes;
+	std::ostringstream oss;
+	std::cout << count << " values x " << repeat << " times" << std::endl;
+	const double&& stream6 = Measure("ostream <<", count, repeat, bytes, [&] { return WriteStream(oss, values); });
+	oss << std::setprecision(17);
+	const double&& stream17 = Measure("ostream << setprecision(17)", count, repeat, bytes, [&] { return WriteStream(oss, values); });
+	const double&& format6 = Measure("DoubleFormat 6", count, repeat, bytes, [&] { return WriteDoubleFormat(text, values, 6); });
+	const double&& shortest = Measure("DoubleFormat shortest", count, repeat, bytes, [&] { return WriteDoubleFormat(text, values, DoubleFormat::Shortest); });
+	std::cout << "Speedup (6 digits)::" << format6 / stream6 << std::endl;
+	std::cout << "Speedup (read back)::" << shortest / stream17 << std::endl;
+	return 0;
+}
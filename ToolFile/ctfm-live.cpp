@@ -0,0 +1,104 @@
+/*
+	This is the cpp file of the tool "ctfm-live" that shows the states of the simulations in progress published to the shared memory.
+	Usage:
+		ctfm-live <IniFileNumber> [RunNumber] [interval] [count]	: Show the state of each N in progress every interval seconds (1 by default), count times (until the simulation finishes by default).
+	The shared memory is not supported on Windows.
+*/
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include "DoubleFormatPackage.h"
+#include "LiveStatePackage.h"
+#ifndef _WIN32
+#include <signal.h>
+#endif // !_WIN32
+
+namespace {
+	void PrintUsage() {
+		std::cerr << "Usage:" << std::endl;
+		std::cerr << "  ctfm-live <IniFileNumber> [RunNumber] [interval] [count]" << std::endl;
+	}
+
+	bool IsAlive(const std::int64_t& processID) {
+#ifndef _WIN32
+		return kill(pid_t(processID), 0) == 0;
+#else
+		(void)processID;
+		return false;
+#endif // !_WIN32
+	}
+
+	void PrintSlots(const LiveStatePackage& live) {
+		const LiveStatePackage::Header& header = live.GetHeader();
+		LiveStatePackage::State state;
+		std::size_t active = 0;
+		for (int i = 0; i < int(header.Slots); i++) {
+			if (!live.Read(i, state) || state.N == 0) {
+				continue;
+			}
+			active++;
+			std::size_t pedals[2 * LiveStatePackage::PedalChanging] = {};
+			for (const std::uint8_t& pedal : state.Pedal) {
+				pedals[pedal % (2 * LiveStatePackage::PedalChanging)]++;
+			}
+			std::cout << i << "," << state.N << "," << (state.Phase == 0 ? "run-up" : "measure") << "," << state.MeasureNumber << "," << state.CompletedMeasurements << "," << state.Step << "," << DoubleFormat::Text(state.Time, 6)
+				<< "," << state.Counter << "," << DoubleFormat::Text(state.LocalV, 6) << "," << DoubleFormat::Text(state.MeanV, 6) << "," << state.StoppedCars;
+			for (int p = 0; p <= int(FootPositionType::Brake); p++) {
+				std::cout << "," << pedals[p] << "," << pedals[p + LiveStatePackage::PedalChanging];
+			}
+			std::cout << std::endl;
+		}
+		if (active == 0) {
+			std::cout << "No N is in progress." << std::endl;
+		}
+	}
+}
+
+int main(int argc, char *argv[]) {
+	if (argc < 2) {
+		PrintUsage();
+		return 1;
+	}
+	int iniFileNumber;
+	int runNumber = 0;
+	double interval = 1;
+	long long count = -1;
+	try {
+		iniFileNumber = std::stoi(argv[1]);
+		if (argc > 2) {
+			runNumber = std::stoi(argv[2]);
+		}
+		if (argc > 3) {
+			interval = std::stod(argv[3]);
+		}
+		if (argc > 4) {
+			count = std::stoll(argv[4]);
+		}
+	}
+	catch (const std::exception&) {
+		PrintUsage();
+		return 1;
+	}
+	const std::string&& name = LiveStatePackage::GetName(iniFileNumber, runNumber);
+	const LiveStatePackage live(name);
+	if (!live.IsOpen()) {
+		std::cerr << "No simulation is publishing:" << name << std::endl;
+		return 1;
+	}
+	const LiveStatePackage::Header& header = live.GetHeader();
+	std::cerr << "Ini::" << header.IniFileNumber << " Run::" << header.RunNumber << " L::" << DoubleFormat::Text(header.L) << " deltaT::" << DoubleFormat::Text(header.deltaT) << " Slots::" << header.Slots << " Max Cars::" << header.MaxCars << " Process ID::" << header.ProcessID << std::endl;
+	std::cout << "Slot,N,Phase,Measure,Completed,Step,Time,Counter,LocalV,MeanV,Stopped,Free,FreeChanging,Accel,AccelChanging,Brake,BrakeChanging" << std::endl;
+	for (long long i = 0; count < 0 || i < count; i++) {
+		if (i > 0) {
+			std::this_thread::sleep_for(std::chrono::duration<double>(interval));
+		}
+		if (!IsAlive(header.ProcessID)) {
+			std::cerr << "The simulation has finished." << std::endl;
+			break;
+		}
+		PrintSlots(live);
+	}
+	return 0;
+}
@@ -0,0 +1,55 @@
+/*
+	This is the cpp file of the tool "ctfm-manifest" that shows the progress of each N recorded in a manifest of the results.
+	Usage:
+		ctfm-manifest <manifest> [done|failed|running|all]	: Show the records of the status as CSV, and the number of the N of each status.
+			The N that have been started are shown by default.
+*/
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include "DoubleFormatPackage.h"
+#include "ManifestPackage.h"
+
+namespace {
+	void PrintUsage() {
+		std::cerr << "Usage:" << std::endl;
+		std::cerr << "  ctfm-manifest <manifest> [done|failed|running|all]" << std::endl;
+	}
+}
+
+int main(int argc, char *argv[]) {
+	if (argc < 2) {
+		PrintUsage();
+		return 1;
+	}
+	const std::string path = argv[1];
+	const std::string filter = argc > 2 ? argv[2] : "";
+	if (!filter.empty() && filter != "done" && filter != "failed" && filter != "running" && filter != "all") {
+		PrintUsage();
+		return 1;
+	}
+	std::vector<ManifestPackage::Entry> entries;
+	if (!ManifestPackage::Read(path, entries)) {
+		std::cerr << "Invalid Manifest:" << path << std::endl;
+		return 1;
+	}
+	std::size_t counts[ManifestPackage::Failed + 1] = {};
+	std::cout << "N,Status,Seed,Attempts,WallTime,V,LocalSD" << std::endl;
+	for (const ManifestPackage::Entry& entry : entries) {
+		counts[entry.Status]++;
+		const std::string&& status = ManifestPackage::StatusToString(entry.Status);
+		if (filter == "all" || filter == status || (filter.empty() && entry.Status != ManifestPackage::NotStarted)) {
+			std::cout << entry.N << "," << status << "," << entry.Seed << "," << entry.Attempts << "," << DoubleFormat::Text(entry.WallTime, 6) << ",";
+			if (entry.Status == ManifestPackage::Done) {
+				std::cout << DoubleFormat::Text(entry.V) << "," << DoubleFormat::Text(entry.LocalStandardDeviation);
+			}
+			else {
+				std::cout << ",";
+			}
+			std::cout << std::endl;
+		}
+	}
+	std::cerr << "Done::" << counts[ManifestPackage::Done] << " Failed::" << counts[ManifestPackage::Failed] << " Running::" << counts[ManifestPackage::Running] << " Not Started::" << counts[ManifestPackage::NotStarted] << std::endl;
+	return 0;
+}
@@ -0,0 +1,333 @@
+/*
+	This is the cpp file of the tool "ctfm-snap" that handles the binary snapshot files.
+	Usage:
+		ctfm-snap info <snapshot>	: Show the header and the number of the frames.
+		ctfm-snap csv <snapshot> [output.csv] [x|v|a] [digits]	: Export a channel to the CSV of the previous versions. The default output is the snapshot path with ".csv".
+			The numbers have the significant digits (1-15), or the shortest digits read back to the same value by default.
+		ctfm-snap list <archive>	: Show the entries of a snapshot archive.
+		ctfm-snap extract <archive> [output folder] [N] [MeasureN]	: Extract the entries to the files. All entries by default, or the entries of the N (and the measurement).
+		ctfm-snap query <snapshot or archive> [time=<start>:<end>] [cars=<1,5,10-20>] [window=<start x>:<end x>] [N=<N>] [measure=<MeasureN>] [output=<output.csv>] [digits=<digits>]
+			: Write the states of the selected cars at the selected times as "time,car,x,v,a" (the recorded channels only). All of them by default, and to the standard output.
+			  The entry of an archive is chosen by N and the measurement number, or the first one is read.
+*/
+
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include "DoubleFormatPackage.h"
+#include "FileSystemPackage.h"
+#include "SnapShotArchivePackage.h"
+#include "SnapShotReaderPackage.h"
+
+namespace {
+	void PrintUsage() {
+		std::cerr << "Usage:" << std::endl;
+		std::cerr << "  ctfm-snap info <snapshot>" << std::endl;
+		std::cerr << "  ctfm-snap csv <snapshot> [output.csv] [x|v|a] [digits]" << std::endl;
+		std::cerr << "  ctfm-snap list <archive>" << std::endl;
+		std::cerr << "  ctfm-snap extract <archive> [output folder] [N] [MeasureN]" << std::endl;
+		std::cerr << "  ctfm-snap query <snapshot or archive> [time=<start>:<end>] [cars=<1,5,10-20>] [window=<start x>:<end x>] [N=<N>] [measure=<MeasureN>] [output=<output.csv>] [digits=<digits>]" << std::endl;
+	}
+
+	int Info(const std::string& path) {
+		SnapShotReaderPackage reader(path);
+		const SnapShotFile::Header& header = reader.Header();
+		std::cout << "N=" << header.N << std::endl;
+		std::cout << "MeasureN=" << header.MeasureNumber << std::endl;
+		std::cout << "deltaT=" << header.deltaT << std::endl;
+		std::cout << "L=" << header.L << std::endl;
+		switch (header.Encoding) {
+		case SnapShotFile::Encoding::EventLog:
+			std::cout << "Encoding=eventlog" << std::endl;
+			std::cout << "Keyframe Interval=" << header.BlockFrames << std::endl;
+			break;
+		case SnapShotFile::Encoding::Compressed:
+			std::cout << "Encoding=compressed" << std::endl;
+			std::cout << "Block Frames=" << header.BlockFrames << std::endl;
+			std::cout << "Resolution=" << header.Resolution << std::endl;
+			break;
+		case SnapShotFile::Encoding::VehicleMajor:
+			std::cout << "Encoding=vehicle" << std::endl;
+			std::cout << "Block Frames=" << header.BlockFrames << std::endl;
+			break;
+		case SnapShotFile::Encoding::Dense:
+		default:
+			std::cout << "Encoding=dense" << std::endl;
+			break;
+		}
+		std::cout << "Channels=" << SnapShotFile::ChannelsToString(header.Channels) << std::endl;
+		std::cout << "Precision=" << (header.ValueSize == sizeof(float) ? "float32" : "float64") << std::endl;
+		std::cout << "Frames=" << reader.FrameCount() << (reader.Complete() ? "" : " (incomplete)") << std::endl;
+		if (!header.Metadata.empty()) {
+			std::cout << "Metadata=" << header.Metadata << std::endl;
+		}
+		return 0;
+	}
+
+	int ExportCSV(const std::string& path, const std::string& outputPath, const std::string& channelName, const int& digits) {
+		SnapShotReaderPackage reader(path);
+		const SnapShotFile::Header& header = reader.Header();
+		const std::uint32_t&& channel = SnapShotFile::ParseChannels(channelName);
+		if ((header.Channels & channel) == 0 || SnapShotFile::ChannelCount(channel) != 1) {
+			std::cerr << "Not Recorded Channel:" << channelName << std::endl;
+			return 1;
+		}
+		std::ofstream ofs(outputPath, std::ios::trunc);
+		if (!ofs) {
+			std::cerr << "Cannot Open:" << outputPath << std::endl;
+			return 1;
+		}
+		ofs << "time";
+		for (std::size_t j = 0; j < header.CarNumbers.size(); j++) {
+			ofs << ",N" << header.CarNumbers[j];
+		}
+		ofs << "\n";
+		SnapShotFile::Frame frame;
+		std::string line;
+		for (std::uint64_t i = 0; i < reader.FrameCount(); i++) {
+			if (!reader.ReadFrame(i, frame)) {
+				std::cerr << "Broken Frame:" << i << std::endl;
+				return 1;
+			}
+			const std::vector<double>& values = channel == SnapShotFile::Channel::X ? frame.X : (channel == SnapShotFile::Channel::V ? frame.V : frame.A);
+			line.clear();
+			DoubleFormat::Append(line, frame.Time, digits);
+			for (std::size_t j = 0; j < values.size(); j++) {
+				line += ',';
+				if (!std::isnan(values[j])) {
+					DoubleFormat::Append(line, values[j], digits);
+				}
+			}
+			line += '\n';
+			ofs.write(line.data(), std::streamsize(line.size()));
+		}
+		return 0;
+	}
+
+	bool ReadArchive(const std::string& path, std::ifstream& ifs, std::vector<SnapShotArchivePackage::Entry>& entries) {
+		const std::int64_t&& fileSize = FileSystem::FileSize(path);
+		ifs.open(path, std::ios::binary);
+		bool complete;
+		if (fileSize <= 0 || !ifs || !SnapShotArchivePackage::ReadDirectory(ifs, std::uint64_t(fileSize), entries, complete)) {
+			std::cerr << "Not SnapShot Archive:" << path << std::endl;
+			return false;
+		}
+		if (!complete) {
+			std::cerr << "The archive has no directory. The entries were found by scanning it." << std::endl;
+		}
+		return true;
+	}
+
+	int List(const std::string& path) {
+		std::ifstream ifs;
+		std::vector<SnapShotArchivePackage::Entry> entries;
+		if (!ReadArchive(path, ifs, entries)) {
+			return 1;
+		}
+		std::cout << "N,MeasureN,Offset,Length,Name" << std::endl;
+		for (const SnapShotArchivePackage::Entry& entry : entries) {
+			std::cout << entry.N << "," << entry.MeasureNumber << "," << entry.Offset << "," << entry.Length << "," << entry.Name << std::endl;
+		}
+		return 0;
+	}
+
+	int Extract(const std::string& path, const std::string& outputFolderPath, const int& N, const int& MeasureNumber) {
+		std::ifstream ifs;
+		std::vector<SnapShotArchivePackage::Entry> entries;
+		if (!ReadArchive(path, ifs, entries)) {
+			return 1;
+		}
+		FileSystem::MakeDirectories(outputFolderPath);
+		std::vector<char> buffer;
+		int count = 0;
+		for (const SnapShotArchivePackage::Entry& entry : entries) {
+			if ((N > 0 && entry.N != N) || (MeasureNumber > 0 && entry.MeasureNumber != MeasureNumber)) {
+				continue;
+			}
+			buffer.resize(std::size_t(entry.Length));
+			ifs.clear();
+			ifs.seekg(std::streamoff(entry.Offset));
+			ifs.read(buffer.data(), std::streamsize(buffer.size()));
+			std::ofstream ofs(outputFolderPath + "/" + entry.Name, std::ios::binary | std::ios::trunc);
+			ofs.write(buffer.data(), std::streamsize(buffer.size()));
+			if (!ifs || !ofs) {
+				std::cerr << "Cannot Extract:" << entry.Name << std::endl;
+				return 1;
+			}
+			count++;
+		}
+		std::cout << "Extracted " << count << " entries to " << outputFolderPath << std::endl;
+		return 0;
+	}
+
+	//"<start>:<end>". The omitted one is not changed.
+	void ParseRange(const std::string& text, double& start, double& end) {
+		const std::size_t&& colon = text.find(':');
+		const std::string&& startText = text.substr(0, colon);
+		if (!startText.empty()) {
+			start = std::stod(startText);
+		}
+		if (colon != std::string::npos && colon + 1 < text.size()) {
+			end = std::stod(text.substr(colon + 1));
+		}
+	}
+
+	int Query(const std::string& path, const std::vector<std::string>& options) {
+		SnapShotReaderPackage::Query query;
+		int N = 0;
+		int MeasureNumber = 0;
+		std::string outputPath;
+		int digits = DoubleFormat::Shortest;
+		for (const std::string& option : options) {
+			const std::size_t&& equal = option.find('=');
+			const std::string&& key = option.substr(0, equal);
+			const std::string&& val = equal == std::string::npos ? std::string() : option.substr(equal + 1);
+			if (key == "time") {
+				ParseRange(val, query.StartTime, query.EndTime);
+			}
+			else if (key == "cars") {
+				query.CarNumbers = SnapShotFile::ParseCarNumbers(val);
+			}
+			else if (key == "window") {
+				ParseRange(val, query.WindowStartX, query.WindowEndX);
+			}
+			else if (key == "N") {
+				N = std::stoi(val);
+			}
+			else if (key == "measure") {
+				MeasureNumber = std::stoi(val);
+			}
+			else if (key == "output") {
+				outputPath = val;
+			}
+			else if (key == "digits" && std::stoi(val) >= DoubleFormat::Shortest && std::stoi(val) <= DoubleFormat::MaxDigits) {
+				digits = std::stoi(val);
+			}
+			else {
+				std::cerr << "Invalid Option:" << option << std::endl;
+				return 1;
+			}
+		}
+		//The snapshot in an archive is read from the archive directly.
+		const std::int64_t&& fileSize = FileSystem::FileSize(path);
+		std::uint64_t offset = 0;
+		std::uint64_t length = 0;
+		std::vector<SnapShotArchivePackage::Entry> entries;
+		std::ifstream ifs(path, std::ios::binary);
+		bool complete;
+		if (fileSize > 0 && ifs && SnapShotArchivePackage::ReadDirectory(ifs, std::uint64_t(fileSize), entries, complete)) {
+			std::vector<SnapShotArchivePackage::Entry>::const_iterator&& entry = std::find_if(entries.cbegin(), entries.cend(), [&](const SnapShotArchivePackage::Entry& e) {
+				return (N <= 0 || e.N == N) && (MeasureNumber <= 0 || e.MeasureNumber == MeasureNumber);
+			});
+			if (entry == entries.cend()) {
+				std::cerr << "No Entry:N=" << N << " MeasureN=" << MeasureNumber << std::endl;
+				return 1;
+			}
+			offset = entry->Offset;
+			length = entry->Length;
+			std::cerr << "Entry::" << entry->Name << std::endl;
+		}
+		ifs.close();
+
+		const std::chrono::steady_clock::time_point&& start = std::chrono::steady_clock::now();
+		SnapShotReaderPackage reader(path, offset, length);
+		const SnapShotFile::Header& header = reader.Header();
+		std::ofstream ofs;
+		if (!outputPath.empty()) {
+			ofs.open(outputPath, std::ios::trunc);
+			if (!ofs) {
+				std::cerr << "Cannot Open:" << outputPath << std::endl;
+				return 1;
+			}
+		}
+		std::ostream& os = outputPath.empty() ? std::cout : ofs;
+		const std::uint32_t channels[] = { SnapShotFile::Channel::X, SnapShotFile::Channel::V, SnapShotFile::Channel::A };
+		const char* const names[] = { ",x", ",v", ",a" };
+		std::string line = "time,car";
+		for (std::size_t c = 0; c < 3; c++) {
+			if ((header.Channels & channels[c]) != 0) {
+				line += names[c];
+			}
+		}
+		line += '\n';
+		os.write(line.data(), std::streamsize(line.size()));
+		long long count = 0;
+		const bool&& succeeded = reader.Select(query, [&](const SnapShotReaderPackage::Sample& sample) {
+			line.clear();
+			DoubleFormat::Append(line, sample.Time, digits);
+			line += ',';
+			line += std::to_string(sample.CarNumber);
+			const double values[] = { sample.X, sample.V, sample.A };
+			for (std::size_t c = 0; c < 3; c++) {
+				if ((header.Channels & channels[c]) != 0) {
+					line += ',';
+					DoubleFormat::Append(line, values[c], digits);
+				}
+			}
+			line += '\n';
+			os.write(line.data(), std::streamsize(line.size()));
+			count++;
+		});
+		os.flush();
+		const std::chrono::duration<double>&& elapsed = std::chrono::steady_clock::now() - start;
+		std::cerr << "Query::" << count << " rows " << elapsed.count() * 1e3 << "ms" << std::endl;
+		if (!succeeded) {
+			std::cerr << "Broken Frame" << std::endl;
+			return 1;
+		}
+		return 0;
+	}
+}
+
+int main(int argc, char *argv[]) {
+	if (argc < 3) {
+		PrintUsage();
+		return 1;
+	}
+	const std::string command = argv[1];
+	const std::string path = argv[2];
+	try {
+		if (command == "info") {
+			return Info(path);
+		}
+		else if (command == "csv") {
+			std::string outputPath = path.substr(0, path.find_last_of('.')) + ".csv";
+			std::string channelName = "x";
+			if (argc > 3) {
+				outputPath = argv[3];
+			}
+			int digits = DoubleFormat::Shortest;
+			if (argc > 4) {
+				channelName = argv[4];
+			}
+			if (argc > 5) {
+				digits = std::stoi(argv[5]);
+				if (digits < DoubleFormat::Shortest || digits > DoubleFormat::MaxDigits) {
+					std::cerr << "Invalid Digits:" << argv[5] << std::endl;
+					return 1;
+				}
+			}
+			return ExportCSV(path, outputPath, channelName, digits);
+		}
+		else if (command == "list") {
+			return List(path);
+		}
+		else if (command == "extract") {
+			const std::string&& outputFolderPath = argc > 3 ? std::string(argv[3]) : path.substr(0, path.find_last_of('.'));
+			const int&& N = argc > 4 ? std::stoi(argv[4]) : 0;
+			const int&& MeasureNumber = argc > 5 ? std::stoi(argv[5]) : 0;
+			return Extract(path, outputFolderPath, N, MeasureNumber);
+		}
+		else if (command == "query") {
+			return Query(path, std::vector<std::string>(argv + 3, argv + argc));
+		}
+	}
+	catch (const std::exception& e) {
+		std::cerr << e.what() << std::endl;
+		return 1;
+	}
+	PrintUsage();
+	return 1;
+}